@@ -1,31 +1,110 @@
 #include <iostream>
 #include <filesystem>
 #include <fstream>
+#include <string>
+#include <string_view>
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <sstream>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <unordered_map>
+#include <chrono>
+#include <iomanip>
+#include <bit>
+#include <queue>
+#include <cstring>
+#include <random>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define ASSEMBLER_MAP_SOURCE_FILES
+#endif
+
+//SSE2 Is Part Of Every x86-64 CPU, Anything Else Decodes Byte Sequences One Character At A Time
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ASSEMBLER_DECODE_HEX_WITH_SSE2
+#endif
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <poll.h>
+#define ASSEMBLER_WATCH_WITH_INOTIFY
+#endif
+
+//Without inotify The Source Folder Is Checked This Often For Changes
+#define ASSEMBLER_WATCH_POLL_MILLISECONDS 100
+//Editors Often Save A File In Several Steps, So A Rebuild Waits Until Nothing Has Changed For This Long
+#define ASSEMBLER_WATCH_SETTLE_MILLISECONDS 30
+
+//How Many Of The Slowest Files --stats Lists, The JSON Report Lists Every File
+#define ASSEMBLER_STATS_SLOWEST_FILES 10
+
+//The Cartridge Header Comes First In The ROM, Followed By The 28 Bytes Of ARM Code That Switch To THUMB And Jump To ENTRY
+#define ASSEMBLER_ROM_HEADER_SIZE 192
+#define ASSEMBLER_ROM_START_CODE_SIZE 28
+#define ASSEMBLER_ROM_TITLE "MYGAME"
+#define ASSEMBLER_ROM_GAME_CODE "0000"
+#define ASSEMBLER_ROM_MAKER_CODE "00"
 
 #define ASSEMBLER_VERSION_MAJOR 1
 #define ASSEMBLER_VERSION_MINOR 0
 #define ASSEMBLER_VERSION_PATCH 0
 
-#if defined ASSEMBLER_CONFIG_DEBUG
-#define ASSEMBLER_OUTPUT_SYMBOL_0 '0'
-#define ASSEMBLER_OUTPUT_SYMBOL_1 '1'
-#define ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER '2'
-#define ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION '\n'
-#define ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING "\n"
+//Bump Whenever The Layout Of An Object File Or Anything PreProcess Records Changes
+#define ASSEMBLER_OBJECT_FORMAT_VERSION 4
+#define ASSEMBLER_OBJECT_MAGIC "GBAO"
 
-#define ASSEMBLER_INSTRUCTION_CHAR_SIZE 17
+#if defined ASSEMBLER_CONFIG_DEBUG
+#define ASSEMBLER_WRITE_BIT_LISTING
 #endif
 
-#if defined ASSEMBLER_CONFIG_RELEASE
-#define ASSEMBLER_OUTPUT_SYMBOL_0 '\0'
-#define ASSEMBLER_OUTPUT_SYMBOL_1 '\1'
-#define ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER '\2'
-#define ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION '\3'
-#define ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING "\3"
-
-#define ASSEMBLER_INSTRUCTION_CHAR_SIZE 16
+//The Bit Listing Is Written While PreProcessing, So Files Are Only Taken From The Cache When There Is No Listing To Write
+#ifndef ASSEMBLER_WRITE_BIT_LISTING
+#define ASSEMBLER_USE_BUILD_CACHE
+#define ASSEMBLER_CACHE_DIRECTORY "AssemblerCache"
 #endif
 
+#define ASSEMBLER_LISTING_SYMBOL_0 '0'
+#define ASSEMBLER_LISTING_SYMBOL_1 '1'
+#define ASSEMBLER_LISTING_SYMBOL_PLACEHOLDER '2'
+#define ASSEMBLER_LISTING_SYMBOL_END_OF_INSTRUCTION '\n'
+
+#define ASSEMBLER_INSTRUCTION_BYTE_SIZE 2
+
+#define ASSEMBLER_PLACEHOLDER_SIZE_BRANCH 8
+#define ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH 10
+#define ASSEMBLER_PLACEHOLDER_SIZE_LINK_BRANCH 12
+#define ASSEMBLER_PLACEHOLDER_SIZE_MOV_ADDRESS 7
+#define ASSEMBLER_PLACEHOLDER_SIZE_VENEER 9
+
+//Shorter Forms Branch Relaxation Can Pick When The Target Is Close Enough
+#define ASSEMBLER_RELAXED_SIZE_BRANCH 1
+#define ASSEMBLER_RELAXED_SIZE_CONDITIONAL_BRANCH 1
+#define ASSEMBLER_RELAXED_SIZE_CONDITIONAL_SKIP 2
+#define ASSEMBLER_RELAXED_SIZE_LINK_BRANCH 2
+#define ASSEMBLER_RELAXED_SIZE_VENEER 2
+#define ASSEMBLER_RELAXED_SIZE_VENEER_LINK 3
+#define ASSEMBLER_RELAXED_SIZE_MOV_ADDRESS 1
+
+//LDR Rd, [PC, #imm] Reaches At Most 1020 Bytes Past The Word-Aligned PC, So A Pool Is Never Given More Entries Than That
+#define ASSEMBLER_LITERAL_OFFSET_MAX 1020
+#define ASSEMBLER_LITERAL_POOL_MAX_ENTRIES 255
+
+//Offsets Are In Instructions, Relative To The Instruction Two After The Branch
+#define ASSEMBLER_BRANCH_OFFSET_MIN -1024
+#define ASSEMBLER_BRANCH_OFFSET_MAX 1023
+#define ASSEMBLER_CONDITIONAL_BRANCH_OFFSET_MIN -128
+#define ASSEMBLER_CONDITIONAL_BRANCH_OFFSET_MAX 127
+#define ASSEMBLER_LINK_BRANCH_OFFSET_MIN -2097152
+#define ASSEMBLER_LINK_BRANCH_OFFSET_MAX 2097151
+
 #define ASSEMBLER_BRANCH_TYPE char
 #define ASSEMBLER_BRANCH_EQ 0
 #define ASSEMBLER_BRANCH_NE 1
@@ -44,6 +123,25 @@
 #define ASSEMBLER_BRANCH_AL 14
 #define ASSEMBLER_BRANCH_NV 15
 #define ASSEMBLER_BRANCH_LINK 16
+#define ASSEMBLER_BRANCH_VENEER 17
+
+#define ASSEMBLER_SYMBOL_TYPE char
+#define ASSEMBLER_SYMBOL_LABEL 0
+#define ASSEMBLER_SYMBOL_BYTE_SEQUENCE 1
+#define ASSEMBLER_SYMBOL_PTR_SEQUENCE 2
+
+#define ASSEMBLER_SYMBOL_TABLE_INITIAL_CAPACITY 1024
+
+//How Step 10 Of PreProcess Handles A Mnemonic
+#define ASSEMBLER_MNEMONIC_TYPE char
+#define ASSEMBLER_MNEMONIC_OPCODE 0
+#define ASSEMBLER_MNEMONIC_NO_PARAMETERS 1
+#define ASSEMBLER_MNEMONIC_BRANCH 2
+#define ASSEMBLER_MNEMONIC_MOV_ADDRESS 3
+#define ASSEMBLER_MNEMONIC_UNPREDICTABLE 4
+
+//Must Be A Power Of Two, Kept At Least Twice The Amount Of Mnemonics So Probes Stay Short
+#define ASSEMBLER_MNEMONIC_TABLE_SIZE 128
 
 #define ASSEMBLER_MEM_BIOS    0x00000000
 #define ASSEMBLER_MEM_ERAM    0x02000000
@@ -54,43 +152,129 @@
 #define ASSEMBLER_MEM_OAM     0x07000000
 #define ASSEMBLER_MEM_ROM     0x08000000
 
+//The Longest MOV/LSL/NEG/ADD Sequence Worth Using Instead Of A Literal Pool Load
+#define ASSEMBLER_MAX_CONSTANT_SIZE 3
+
+//~align Takes Powers Of Two Up To This, So Padding Before Any Piece Of Data Is Always Shorter
+#define ASSEMBLER_MAX_DATA_ALIGNMENT 128
+#define ASSEMBLER_DATA_ALIGNMENT_CLASSES 8
+
+//~compress Formats, Each Written As The Stream A BIOS Decompression Call Expects
+#define ASSEMBLER_COMPRESSION_TYPE char
+#define ASSEMBLER_COMPRESSION_NONE 0
+#define ASSEMBLER_COMPRESSION_LZ77 1
+#define ASSEMBLER_COMPRESSION_RLE 2
+#define ASSEMBLER_COMPRESSION_HUFFMAN 3
+
+//Every Stream Starts With A Word Holding The Decompressed Size In Its Top 24 Bits, The BIOS Also Needs That Word To Be Word Aligned
+#define ASSEMBLER_COMPRESSION_MAX_SIZE 0xFFFFFF
+#define ASSEMBLER_COMPRESSION_ALIGNMENT 4
+
+//A Cached Stream Comes After The Hash Of The Bytes It Was Compressed From, Its Own Size And Its Own Hash, Each A Native uint64_t
+#define ASSEMBLER_COMPRESSION_CACHE_HEADER_SIZE 24
+
+#define ASSEMBLER_LZ77_WINDOW_SIZE 4096
+#define ASSEMBLER_LZ77_MIN_MATCH 3
+#define ASSEMBLER_LZ77_MAX_MATCH 18
+//SWI 0x12 Writes VRAM A Halfword At A Time, So A Match Can Not Copy The Byte Right Before It
+#define ASSEMBLER_LZ77_MIN_DISTANCE 2
+#define ASSEMBLER_LZ77_HASH_BITS 15
+#define ASSEMBLER_LZ77_MAX_CHAIN 256
+
+#define ASSEMBLER_RLE_MIN_RUN 3
+#define ASSEMBLER_RLE_MAX_RUN 130
+#define ASSEMBLER_RLE_MAX_LITERALS 128
+
+//Huffman Tree Nodes Only Have 6 Bits To Say How Many Node Pairs Ahead Their Children Are
+#define ASSEMBLER_HUFFMAN_MAX_NODE_OFFSET 63
+
+//The Condition Flags, As Far As --peephole Needs To Know Which Of Them An Instruction Sets Or Reads
+#define ASSEMBLER_FLAG_N 0b1000
+#define ASSEMBLER_FLAG_Z 0b0100
+#define ASSEMBLER_FLAG_C 0b0010
+#define ASSEMBLER_FLAG_V 0b0001
+#define ASSEMBLER_FLAGS_NZ (ASSEMBLER_FLAG_N | ASSEMBLER_FLAG_Z)
+#define ASSEMBLER_FLAGS_CV (ASSEMBLER_FLAG_C | ASSEMBLER_FLAG_V)
+#define ASSEMBLER_FLAGS_NZCV (ASSEMBLER_FLAGS_NZ | ASSEMBLER_FLAGS_CV)
+
+//Labels, Branches, MOV Addresses And Literal Pools Are Kept Relative To Their Section: "fileNumber" Names The Section
+//And The Instruction Number Is Counted From Its Start, So Laying Out The Sections Never Has To Touch Them
 struct LabelInfo
 {
-	std::string label;
 	uint64_t fileNumber;
 	uint64_t instructionNumber;
 };
 
+//A Relocation: "placeholderSize" Instructions Starting At "InstructionNumber" Are Filled In Once "label" Is Known
 struct BranchInfo
 {
 	ASSEMBLER_BRANCH_TYPE type;
 	uint64_t fileNumber;
 	uint64_t InstructionNumber;
 	std::string label;
+	uint64_t placeholderSize;
 };
 
 struct ByteSequenceInfo
 {
-	std::string label;
 	std::vector<char> bytes;
 	uint64_t alignment;
 	uint64_t address;
+	ASSEMBLER_COMPRESSION_TYPE compression;
+	//~incbin Sequences Leave "bytes" Empty, Their Bytes Are Read Straight Into The ROM From "includedPath" (Relative To The Source Folder)
+	//"includedFileSize" Is The Size Of The Whole File When It Was PreProcessed, Which The Build Cache Checks Before Using It Again
+	std::string includedPath = {};
+	uint64_t includedOffset = 0;
+	uint64_t includedSize = 0;
+	uint64_t includedFileSize = 0;
 };
 
 struct PtrSequenceInfo
 {
-	std::string label;
 	std::vector<std::string> pointers;
 	std::vector<char> bytes;
 	uint64_t address;
 };
 
+//A Relocation: "placeholderSize" Instructions Starting At "InstructionNumber" Are Filled In Once "label" Is Known
+//"literalPool" Is UINT64_MAX When The Address Has No Literal Pool Entry And Has To Be Built Up With MOV/LSL/ADD
 struct MovAddressInfo
 {
 	std::string label;
 	int destinationRegister;
 	uint64_t fileNumber;
 	uint64_t InstructionNumber;
+	uint64_t placeholderSize;
+	uint64_t literalPool;
+	uint64_t literalPoolEntry;
+};
+
+//32-Bit Addresses Loaded By MOVA, Placed Where Execution Never Falls Into Them
+//Laid Out As An Optional B Over The Pool, Then One Halfword Of Padding (Before Or After The Entries) To Word Align The Entries
+struct LiteralPoolInfo
+{
+	uint64_t fileNumber;
+	uint64_t InstructionNumber;
+	uint64_t amountOfEntries;
+	bool skipped;
+};
+
+//A Byte Or Pointer Sequence As Seen By The Data Layout, Which Only Needs Its Size And Alignment
+struct DataLayoutInfo
+{
+	uint64_t alignment;
+	uint64_t size;
+	uint64_t address;
+	bool placed;
+};
+
+//A Symbol Or A Pair Of Children While A Huffman Tree Is Built For ~compress "huffman"
+struct HuffmanNodeInfo
+{
+	uint64_t frequency;
+	uint64_t children[2];
+	uint8_t symbol;
+	bool leaf;
 };
 
 struct JoinInfo
@@ -99,15 +283,177 @@ struct JoinInfo
 	uint64_t childFile;
 };
 
+//One Rewrite Made By --peephole, "instructionNumber" Is Where It Took Place Once The Removed Instructions Are Gone
+//"label" Is The Closest Label Before It In The Same File, Or Empty If There Is None
+struct PeepholeRewriteInfo
+{
+	uint64_t fileNumber;
+	uint64_t instructionNumber;
+	std::string label;
+	std::string description;
+};
+
+//"index" Is The Position Of The Symbol In The Label, Byte Sequence Or Pointer Sequence Map Depending On "type"
+struct SymbolInfo
+{
+	std::string name;
+	ASSEMBLER_SYMBOL_TYPE type;
+	uint64_t index;
+};
+
+//Open-Addressing Hash Table Holding One Copy Of Every Symbol Name, An Empty Name Marks An Unused Slot
+struct SymbolTable
+{
+	std::vector<SymbolInfo> slots;
+	uint64_t symbolCount = 0;
+};
+
+struct SymbolDefinitionInfo
+{
+	std::string name;
+	size_t lineNumber;
+};
+
+//"processInstruction" Fills In The Opcode For ASSEMBLER_MNEMONIC_OPCODE And ASSEMBLER_MNEMONIC_NO_PARAMETERS
+//"branchType" And "placeholderSize" Are Only Used For ASSEMBLER_MNEMONIC_BRANCH
+struct MnemonicInfo
+{
+	std::string_view name;
+	ASSEMBLER_MNEMONIC_TYPE type;
+	bool (*processInstruction)(std::string&, uint16_t&);
+	ASSEMBLER_BRANCH_TYPE branchType;
+	uint64_t placeholderSize;
+	bool unconditional;
+};
+
+//A Source File's Text, Memory Mapped Where Possible And Otherwise Read In One Go
+struct SourceTextInfo
+{
+	const char* text = nullptr;
+	size_t size = 0;
+	std::string buffer;
+#ifdef ASSEMBLER_MAP_SOURCE_FILES
+	void* mapping = nullptr;
+
+	SourceTextInfo() = default;
+	SourceTextInfo(const SourceTextInfo&) = delete;
+	SourceTextInfo& operator=(const SourceTextInfo&) = delete;
+	~SourceTextInfo()
+	{
+		if (mapping != nullptr)
+			munmap(mapping, size);
+	}
+#endif
+};
+
+//What It Took To PreProcess One Source File, Reported With --stats
+//"bytesRead" Counts Source Text PreProcessed And Cache Files Loaded, "bytesWritten" Counts The Bit Listing And Cache Files Written
+struct FileStatsInfo
+{
+	std::string path;
+	uint64_t nanoseconds = 0;
+	uint64_t lines = 0;
+	uint64_t instructions = 0;
+	uint64_t labels = 0;
+	uint64_t bytesRead = 0;
+	uint64_t bytesWritten = 0;
+	bool cached = false;
+};
+
+//Everything PreProcess Records For One Source File, Kept Apart From The Global Maps So Files Can Be PreProcessed In Parallel
+struct SourceFileInfo
+{
+	std::filesystem::path path;
+	std::vector<uint16_t> section;
+	SymbolTable symbolTable;
+	std::vector<SymbolDefinitionInfo> symbolDefinitions;
+	std::vector<LabelInfo> labelMap;
+	std::vector<BranchInfo> branchMap;
+	std::vector<ByteSequenceInfo> byteSequenceMap;
+	std::vector<PtrSequenceInfo> ptrSequenceMap;
+	std::vector<MovAddressInfo> movAddressMap;
+	std::vector<LiteralPoolInfo> literalPoolMap;
+	//Relative To The Source Folder, Only Turned Into File Numbers Once Every File Being Assembled Is Known
+	std::vector<std::string> joinPaths;
+	std::ostringstream log;
+	bool preProcessed = false;
+	std::string cache;
+	FileStatsInfo stats;
+};
+
+struct StageStatsInfo
+{
+	const char* name;
+	uint64_t nanoseconds;
+};
+
+//Wall Time Of Each Stage Of The Last Build In The Order They Ran, Along With Counters Gathered On The Way
+struct BuildStatsInfo
+{
+	std::chrono::steady_clock::time_point stageStart;
+	std::vector<StageStatsInfo> stages;
+	std::vector<FileStatsInfo> files;
+	uint64_t symbols = 0;
+	uint64_t symbolTableSlots = 0;
+	uint64_t branches = 0;
+	uint64_t veneers = 0;
+	uint64_t movAddresses = 0;
+	uint64_t literalPools = 0;
+	uint64_t byteSequences = 0;
+	uint64_t ptrSequences = 0;
+	uint64_t mergedByteSequences = 0;
+	uint64_t mergedBytes = 0;
+	uint64_t dataPaddingBytes = 0;
+	uint64_t includedBytes = 0;
+	uint64_t compressedSequences = 0;
+	uint64_t compressionCacheHits = 0;
+	uint64_t uncompressedBytes = 0;
+	uint64_t compressedBytes = 0;
+	uint64_t removedLabels = 0;
+	uint64_t removedCodeBytes = 0;
+	uint64_t removedByteSequences = 0;
+	uint64_t removedPtrSequences = 0;
+	uint64_t removedDataBytes = 0;
+	uint64_t peepholeRewrites = 0;
+	uint64_t peepholeRemovedBytes = 0;
+	uint64_t romBytes = 0;
+	uint64_t paddingBytes = 0;
+};
+
+//Optional Passes Chosen On The Command Line, Kept For Every Build In Watch Mode
+struct BuildOptionsInfo
+{
+	bool mergeData = false;
+	bool collectGarbage = false;
+	bool optimizePeephole = false;
+	uint64_t jobCount = 1;
+};
+
 static std::vector<LabelInfo> s_LabelMap;
 static std::vector<BranchInfo> s_BranchMap;
 static std::vector<ByteSequenceInfo> s_ByteSequenceMap;
 static std::vector<PtrSequenceInfo> s_PtrSequenceMap;
 static std::vector<MovAddressInfo> s_MovAddressMap;
+static std::vector<LiteralPoolInfo> s_LiteralPoolMap;
 static std::vector<JoinInfo> s_JoinMap;
 
-static bool s_SuccessfulIntConversion;
-static uint64_t s_CurrentByteSequenceAlignment;
+static SymbolTable s_SymbolTable;
+
+//One Section Of Instructions Per Source File, Indexed By File Number
+static std::vector<std::vector<uint16_t>> s_SectionMap;
+//The Path Of Every Source File Relative To The Source Folder, Indexed By File Number
+static std::vector<std::filesystem::path> s_SourceFilePathMap;
+
+#ifdef ASSEMBLER_WRITE_BIT_LISTING
+static std::filesystem::path s_ListingPath;
+#endif
+
+static BuildStatsInfo s_BuildStats;
+static BuildOptionsInfo s_BuildOptions;
+
+static thread_local bool s_SuccessfulIntConversion;
+static thread_local uint64_t s_CurrentByteSequenceAlignment;
+static thread_local ASSEMBLER_COMPRESSION_TYPE s_CurrentByteSequenceCompression;
 
 static int StringToDecimalInt(const std::string& str)
 {
@@ -149,7 +495,176 @@ static int StringToHexadecimalInt(const std::string& str)
 	return result;
 }
 
-static void ProcessBranchInstruction(BranchInfo info, std::string& placeholder)
+//~incbin Offsets And Lengths Are Decimal, Or Hexadecimal After "0x", And Have To Be Made Up Entirely Of Digits
+static bool StringToFileOffset(const std::string& str, uint64_t& offset)
+{
+	bool hexadecimal = str.size() > 2 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X');
+	if (str.empty() || str.find_first_not_of(hexadecimal ? "0123456789ABCDEFabcdef" : "0123456789", hexadecimal ? 2 : 0) != std::string::npos)
+		return false;
+	try
+	{
+		offset = std::stoull(str.substr(hexadecimal ? 2 : 0), nullptr, hexadecimal ? 16 : 10);
+	}
+	catch (std::out_of_range const&)
+	{
+		return false;
+	}
+	return true;
+}
+
+static uint64_t ByteSequenceSize(const ByteSequenceInfo& byteSequence)
+{
+	return byteSequence.includedPath.empty() ? byteSequence.bytes.size() : byteSequence.includedSize;
+}
+
+static void ResetBuildStats()
+{
+	s_BuildStats = BuildStatsInfo();
+	s_BuildStats.stageStart = std::chrono::steady_clock::now();
+}
+
+//Each Stage Starts Where The One Before It Ended
+static void EndBuildStage(const char* name)
+{
+	std::chrono::steady_clock::time_point stageEnd = std::chrono::steady_clock::now();
+	s_BuildStats.stages.push_back({ name, (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(stageEnd - s_BuildStats.stageStart).count() });
+	s_BuildStats.stageStart = stageEnd;
+}
+
+//FNV-1a
+static constexpr uint64_t HashSymbolName(std::string_view name)
+{
+	uint64_t hash = 0xCBF29CE484222325;
+	for (size_t i = 0; i < name.size(); i++)
+	{
+		hash ^= (uint8_t)name[i];
+		hash *= 0x00000100000001B3;
+	}
+	return hash;
+}
+
+static SymbolInfo* FindSymbol(SymbolTable& symbolTable, const std::string& name)
+{
+	if (symbolTable.slots.empty())
+		return nullptr;
+
+	uint64_t mask = symbolTable.slots.size() - 1;
+	for (uint64_t slot = HashSymbolName(name) & mask; !symbolTable.slots[slot].name.empty(); slot = (slot + 1) & mask)
+	{
+		if (symbolTable.slots[slot].name == name)
+			return &symbolTable.slots[slot];
+	}
+	return nullptr;
+}
+
+//Returns false If A Symbol With The Same Name Is Already Defined
+static bool AddSymbol(SymbolTable& symbolTable, const std::string& name, ASSEMBLER_SYMBOL_TYPE type, uint64_t index)
+{
+	if (FindSymbol(symbolTable, name) != nullptr)
+		return false;
+
+	//Keep The Load Factor Below 3/4 So Probe Sequences Stay Short
+	if ((symbolTable.symbolCount + 1) * 4 > symbolTable.slots.size() * 3)
+	{
+		std::vector<SymbolInfo> oldSlots = std::move(symbolTable.slots);
+		symbolTable.slots = std::vector<SymbolInfo>(oldSlots.empty() ? ASSEMBLER_SYMBOL_TABLE_INITIAL_CAPACITY : oldSlots.size() * 2);
+		uint64_t mask = symbolTable.slots.size() - 1;
+		for (size_t i = 0; i < oldSlots.size(); i++)
+		{
+			if (oldSlots[i].name.empty())
+				continue;
+
+			uint64_t slot = HashSymbolName(oldSlots[i].name) & mask;
+			while (!symbolTable.slots[slot].name.empty())
+				slot = (slot + 1) & mask;
+			symbolTable.slots[slot] = std::move(oldSlots[i]);
+		}
+	}
+
+	uint64_t mask = symbolTable.slots.size() - 1;
+	uint64_t slot = HashSymbolName(name) & mask;
+	while (!symbolTable.slots[slot].name.empty())
+		slot = (slot + 1) & mask;
+	symbolTable.slots[slot] = { name, type, index };
+	symbolTable.symbolCount++;
+	return true;
+}
+
+//Instructions Are Stored As Packed Halfwords And Written Little-Endian, Exactly As They Appear In The ROM
+static void WriteInstruction(char* instructionBytes, uint16_t opcode)
+{
+	instructionBytes[0] = (char)(opcode & 0x00FF);
+	instructionBytes[1] = (char)((opcode & 0xFF00) >> 8);
+}
+
+//The BIOS Will Not Boot A Cartridge Unless This Exact Logo Is At 0x04 In Its Header
+static constexpr uint8_t s_NintendoLogo[156] =
+{
+	0x24, 0xFF, 0xAE, 0x51, 0x69, 0x9A, 0xA2, 0x21, 0x3D, 0x84, 0x82, 0x0A, 0x84, 0xE4, 0x09, 0xAD,
+	0x11, 0x24, 0x8B, 0x98, 0xC0, 0x81, 0x7F, 0x21, 0xA3, 0x52, 0xBE, 0x19, 0x93, 0x09, 0xCE, 0x20,
+	0x10, 0x46, 0x4A, 0x4A, 0xF8, 0x27, 0x31, 0xEC, 0x58, 0xC7, 0xE8, 0x33, 0x82, 0xE3, 0xCE, 0xBF,
+	0x85, 0xF4, 0xDF, 0x94, 0xCE, 0x4B, 0x09, 0xC1, 0x94, 0x56, 0x8A, 0xC0, 0x13, 0x72, 0xA7, 0xFC,
+	0x9F, 0x84, 0x4D, 0x73, 0xA3, 0xCA, 0x9A, 0x61, 0x58, 0x97, 0xA3, 0x27, 0xFC, 0x03, 0x98, 0x76,
+	0x23, 0x1D, 0xC7, 0x61, 0x03, 0x04, 0xAE, 0x56, 0xBF, 0x38, 0x84, 0x00, 0x40, 0xA7, 0x0E, 0xFD,
+	0xFF, 0x52, 0xFE, 0x03, 0x6F, 0x95, 0x30, 0xF1, 0x97, 0xFB, 0xC0, 0x85, 0x60, 0xD6, 0x80, 0x25,
+	0xA9, 0x63, 0xBE, 0x03, 0x01, 0x4E, 0x38, 0xE2, 0xF9, 0xA2, 0x34, 0xFF, 0xBB, 0x3E, 0x03, 0x44,
+	0x78, 0x00, 0x90, 0xCB, 0x88, 0x11, 0x3A, 0x94, 0x65, 0xC0, 0x7C, 0x63, 0x87, 0xF0, 0x3C, 0xAF,
+	0xD6, 0x25, 0xE4, 0x8B, 0x38, 0x0A, 0xAC, 0x72, 0x21, 0xD4, 0xF8, 0x07
+};
+
+static_assert(sizeof(ASSEMBLER_ROM_TITLE) - 1 <= 12 && sizeof(ASSEMBLER_ROM_GAME_CODE) - 1 == 4 && sizeof(ASSEMBLER_ROM_MAKER_CODE) - 1 == 2);
+
+//Fills In The First ASSEMBLER_ROM_HEADER_SIZE Bytes Of The ROM, Every Field The BIOS Or A Flash Cart Looks At Is Set
+static void WriteROMHeader(char* header)
+{
+	std::memset(header, 0, ASSEMBLER_ROM_HEADER_SIZE);
+
+	//B 0x080000C0, Over The Header To The Start Up Code
+	header[0x00] = '\x2E';
+	header[0x01] = '\x00';
+	header[0x02] = '\x00';
+	header[0x03] = '\xEA';
+
+	std::memcpy(header + 0x04, s_NintendoLogo, sizeof(s_NintendoLogo));
+	std::memcpy(header + 0xA0, ASSEMBLER_ROM_TITLE, sizeof(ASSEMBLER_ROM_TITLE) - 1);
+	std::memcpy(header + 0xAC, ASSEMBLER_ROM_GAME_CODE, 4);
+	std::memcpy(header + 0xB0, ASSEMBLER_ROM_MAKER_CODE, 2);
+	header[0xB2] = '\x96';
+
+	//The Complement Check Makes The Bytes From 0xA0 To 0xBD Add Up To -0x19
+	uint8_t complement = 0;
+	for (size_t i = 0xA0; i < 0xBD; i++)
+		complement -= (uint8_t)header[i];
+	header[0xBD] = (char)(complement - 0x19);
+}
+
+#ifdef ASSEMBLER_WRITE_BIT_LISTING
+static void WriteBitListing(std::fstream& listingStream, uint16_t opcode)
+{
+	char listingSymbols[17];
+	for (size_t i = 0; i < 16; i++)
+	{
+		if (opcode & (0x8000 >> i))
+			listingSymbols[i] = ASSEMBLER_LISTING_SYMBOL_1;
+		else
+			listingSymbols[i] = ASSEMBLER_LISTING_SYMBOL_0;
+	}
+	listingSymbols[16] = ASSEMBLER_LISTING_SYMBOL_END_OF_INSTRUCTION;
+	listingStream.write(listingSymbols, 17);
+}
+
+static void WritePlaceholderListing(std::fstream& listingStream, uint64_t placeholderSize)
+{
+	char listingSymbols[17];
+	for (size_t i = 0; i < 16; i++)
+		listingSymbols[i] = ASSEMBLER_LISTING_SYMBOL_PLACEHOLDER;
+	listingSymbols[16] = ASSEMBLER_LISTING_SYMBOL_END_OF_INSTRUCTION;
+	for (uint64_t i = 0; i < placeholderSize; i++)
+		listingStream.write(listingSymbols, 17);
+}
+#endif
+
+static void ProcessBranchInstruction(BranchInfo info, std::vector<BranchInfo>& branchMap)
 {
 	size_t i = 0;
 	size_t j = 0;
@@ -162,47 +677,21 @@ static void ProcessBranchInstruction(BranchInfo info, std::string& placeholder)
 		}
 	}
 	info.label.erase(0, j);
-	s_BranchMap.push_back(info);
-	placeholder.clear();
-	for (i = 0; i < 20 * 8; i++)
-	{
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		if (i % 16 == 0 && i != 0)
-			placeholder.push_back(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION);
-#endif
-
-		placeholder.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-	}
+	branchMap.push_back(info);
 }
 
-static bool ProcessNOPInstruction(std::string& nopParameters)
+static bool ProcessNOPInstruction(std::string& nopParameters, uint16_t& nopOpcode)
 {
 	for (size_t i = 0; i < nopParameters.size(); i++)
 	{
 		if (nopParameters[i] != ' ')
 			return false;
 	}
-	nopParameters.clear();
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	nopParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
+	nopOpcode = 0b0000000000000000;
 	return true;
 }
 
-static bool ProcessADCInstruction(std::string& adcParameters)
+static bool ProcessADCInstruction(std::string& adcParameters, uint16_t& adcOpcode)
 {
 	for (size_t i = 0; i < adcParameters.size(); i++)
 	{
@@ -250,53 +739,13 @@ static bool ProcessADCInstruction(std::string& adcParameters)
 			return false;
 	}
 
-	adcParameters.clear();
-
-	adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-
-	if (Rm & 4)
-		adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rm & 2)
-		adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rm & 1)
-		adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 4)
-		adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 2)
-		adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 1)
-		adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		adcParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
+	adcOpcode = 0b0100000101000000;
+	adcOpcode |= Rm << 3;
+	adcOpcode |= Rd;
 	return true;
 }
 
-static bool ProcessADDInstruction(std::string& addParameters)
+static bool ProcessADDInstruction(std::string& addParameters, uint16_t& addOpcode)
 {
 	for (size_t i = 0; i < addParameters.size(); i++)
 	{
@@ -343,68 +792,9 @@ static bool ProcessADDInstruction(std::string& addParameters)
 		if (immediate < 0 || immediate > 255)
 			return false;
 
-		addParameters.clear();
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 4)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 2)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 1)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 128)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 64)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 32)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 16)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 8)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 4)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 2)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 1)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
+		addOpcode = 0b0011000000000000;
+		addOpcode |= Rd << 8;
+		addOpcode |= immediate;
 		return true;
 	}
 
@@ -444,60 +834,10 @@ static bool ProcessADDInstruction(std::string& addParameters)
 		if (immediate < 0 || immediate > 7)
 			return false;
 
-		addParameters.clear();
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 4)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 2)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 1)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rn & 4)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rn & 2)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rn & 1)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 4)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 2)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 1)
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
+		addOpcode = 0b0001110000000000;
+		addOpcode |= immediate << 6;
+		addOpcode |= Rn << 3;
+		addOpcode |= Rd;
 		return true;
 	}
 
@@ -517,64 +857,14 @@ static bool ProcessADDInstruction(std::string& addParameters)
 
 	char Rm = addParameters[7] - '0';
 
-	addParameters.clear();
-	addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rm & 4)
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rm & 2)
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rm & 1)
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rn & 4)
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rn & 2)
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rn & 1)
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 4)
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 2)
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 1)
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
+	addOpcode = 0b0001100000000000;
+	addOpcode |= Rm << 6;
+	addOpcode |= Rn << 3;
+	addOpcode |= Rd;
 	return true;
 }
 
-static bool ProcessADDHIInstruction(std::string& addhiParameters)
+static bool ProcessADDHIInstruction(std::string& addhiParameters, uint16_t& addhiOpcode)
 {
 	for (size_t i = 0; i < addhiParameters.size(); i++)
 	{
@@ -622,119 +912,24 @@ static bool ProcessADDHIInstruction(std::string& addhiParameters)
 			return false;
 	}
 
-	addhiParameters.clear();
-
 	if (Rd < 8 && Rm < 8)
 	{
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rm & 4)
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rm & 2)
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rm & 1)
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 4)
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 2)
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 1)
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 4)
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 2)
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 1)
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
+		addhiOpcode = 0b0001100000000000;
+		addhiOpcode |= Rm << 6;
+		addhiOpcode |= Rd << 3;
+		addhiOpcode |= Rd;
 		return true;
 	}
 
-	addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 8)
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rm & 8)
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rm & 4)
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rm & 2)
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rm & 1)
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 4)
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 2)
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 1)
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addhiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
+	addhiOpcode = 0b0100010000000000;
+	addhiOpcode |= (Rd & 8) << 4;
+	addhiOpcode |= (Rm & 8) << 3;
+	addhiOpcode |= (Rm & 7) << 3;
+	addhiOpcode |= Rd & 7;
 	return true;
 }
 
-static bool ProcessADDSPInstruction(std::string& addspParameters)
+static bool ProcessADDSPInstruction(std::string& addspParameters, uint16_t& addspOpcode)
 {
 	for (size_t i = 0; i < addspParameters.size(); i++)
 	{
@@ -744,7 +939,7 @@ static bool ProcessADDSPInstruction(std::string& addspParameters)
 			i = addspParameters.size();
 		}
 	}
-	
+
 	if (addspParameters.size() < 2)
 		return false;
 	if (addspParameters[0] != '#')
@@ -757,66 +952,21 @@ static bool ProcessADDSPInstruction(std::string& addspParameters)
 	if (immediate < 0 || immediate > 127)
 		return false;
 
-	addspParameters.clear();
-	addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-
-	if (immediate & 64)
-		addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (immediate & 32)
-		addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (immediate & 16)
-		addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (immediate & 8)
-		addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (immediate & 4)
-		addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (immediate & 2)
-		addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (immediate & 1)
-		addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		addspParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
+	addspOpcode = 0b1011000010000000;
+	addspOpcode |= immediate;
 	return true;
 }
 
-static bool ProcessANDInstruction(std::string& andParameters)
+static bool ProcessANDInstruction(std::string& andParameters, uint16_t& andOpcode)
 {
-	if (!ProcessADCInstruction(andParameters))
+	if (!ProcessADCInstruction(andParameters, andOpcode))
 		return false;
 
-	andParameters[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-	andParameters[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
+	andOpcode &= ~0b0000000101000000;
 	return true;
 }
 
-static bool ProcessASRInstruction(std::string& asrParameters)
+static bool ProcessASRInstruction(std::string& asrParameters, uint16_t& asrOpcode)
 {
 	for (size_t i = 0; i < asrParameters.size(); i++)
 	{
@@ -886,125 +1036,49 @@ static bool ProcessASRInstruction(std::string& asrParameters)
 		if (convertedValue == 32)
 			convertedValue = 0;
 
-		asrParameters.clear();
-
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (convertedValue & 16)
-			asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (convertedValue & 8)
-			asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (convertedValue & 4)
-			asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (convertedValue & 2)
-			asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (convertedValue & 1)
-			asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
+		asrOpcode = 0b0001000000000000;
+		asrOpcode |= convertedValue << 6;
 	}
 	else
 	{
-		asrParameters.clear();
-
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
+		asrOpcode = 0b0100000100000000;
 	}
 
-	if (Rm & 4)
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rm & 2)
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rm & 1)
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 4)
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 2)
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 1)
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		asrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
+	asrOpcode |= Rm << 3;
+	asrOpcode |= Rd;
 	return true;
 }
 
-static bool ProcessBICInstruction(std::string& bicParameters)
+static bool ProcessBICInstruction(std::string& bicParameters, uint16_t& bicOpcode)
 {
-	if (!ProcessADCInstruction(bicParameters))
+	if (!ProcessADCInstruction(bicParameters, bicOpcode))
 		return false;
 
-	bicParameters[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-	bicParameters[8] = ASSEMBLER_OUTPUT_SYMBOL_1;
-	bicParameters[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
+	bicOpcode |= 0b0000001010000000;
+	bicOpcode &= ~0b0000000001000000;
 	return true;
 }
 
-static bool ProcessRETURNInstruction(std::string& returnParameters)
+static bool ProcessRETURNInstruction(std::string& returnParameters, uint16_t& returnOpcode)
 {
-	if (!ProcessNOPInstruction(returnParameters))
+	if (!ProcessNOPInstruction(returnParameters, returnOpcode))
 		return false;
 
-	returnParameters[0] = ASSEMBLER_OUTPUT_SYMBOL_1;
-	returnParameters[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-	returnParameters[3] = ASSEMBLER_OUTPUT_SYMBOL_1;
-	returnParameters[4] = ASSEMBLER_OUTPUT_SYMBOL_1;
-	returnParameters[5] = ASSEMBLER_OUTPUT_SYMBOL_1;
-	returnParameters[7] = ASSEMBLER_OUTPUT_SYMBOL_1;
+	returnOpcode |= 0b1011110100000000;
 	return true;
 }
 
-static bool ProcessCMNInstruction(std::string& cmnParameters)
+static bool ProcessCMNInstruction(std::string& cmnParameters, uint16_t& cmnOpcode)
 {
-	if (!ProcessADCInstruction(cmnParameters))
+	if (!ProcessADCInstruction(cmnParameters, cmnOpcode))
 		return false;
 
-	cmnParameters[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-	cmnParameters[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-	cmnParameters[8] = ASSEMBLER_OUTPUT_SYMBOL_1;
+	cmnOpcode |= 0b0000001010000000;
+	cmnOpcode &= ~0b0000000100000000;
 	return true;
 }
 
-static bool ProcessCMPInstruction(std::string& cmpParameters)
+static bool ProcessCMPInstruction(std::string& cmpParameters, uint16_t& cmpOpcode)
 {
 	for (size_t i = 0; i < cmpParameters.size(); i++)
 	{
@@ -1052,69 +1126,9 @@ static bool ProcessCMPInstruction(std::string& cmpParameters)
 		if (convertedValue < 0 || convertedValue > 255)
 			return false;
 
-		cmpParameters.clear();
-
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-
-		if (Rd & 4)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 2)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 1)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (convertedValue & 128)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (convertedValue & 64)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (convertedValue & 32)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (convertedValue & 16)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (convertedValue & 8)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (convertedValue & 4)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (convertedValue & 2)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (convertedValue & 1)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
+		cmpOpcode = 0b0010100000000000;
+		cmpOpcode |= (Rd & 7) << 8;
+		cmpOpcode |= convertedValue;
 		return true;
 	}
 
@@ -1128,120 +1142,39 @@ static bool ProcessCMPInstruction(std::string& cmpParameters)
 	if (!s_SuccessfulIntConversion)
 		return false;
 
-	cmpParameters.clear();
 	if (Rd > 7 || Rm > 7)
 	{
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-
-		if (Rd & 8)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rm & 8)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rm & 4)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rm & 2)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rm & 1)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 4)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 2)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 1)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
+		cmpOpcode = 0b0100010100000000;
+		cmpOpcode |= (Rd & 8) << 4;
+		cmpOpcode |= (Rm & 8) << 3;
+		cmpOpcode |= (Rm & 7) << 3;
+		cmpOpcode |= Rd & 7;
 	}
 	else
 	{
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rm & 4)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rm & 2)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rm & 1)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 4)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 2)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rd & 1)
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			cmpParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
+		cmpOpcode = 0b0100001010000000;
+		cmpOpcode |= Rm << 3;
+		cmpOpcode |= Rd;
 	}
 
 	return true;
 }
 
-static bool ProcessXORInstruction(std::string& xorParameters)
+static bool ProcessXORInstruction(std::string& xorParameters, uint16_t& xorOpcode)
 {
-	if (!ProcessADCInstruction(xorParameters))
+	if (!ProcessADCInstruction(xorParameters, xorOpcode))
 		return false;
 
-	xorParameters[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
+	xorOpcode &= ~0b0000000100000000;
 	return true;
 }
 
-static bool ProcessLDMIAInstruction(std::string& ldmiaParameters)
+static bool ProcessLDMIAInstruction(std::string& ldmiaParameters, uint16_t& ldmiaOpcode)
 {
 	return false;
 }
 
-static bool ProcessLDRInstruction(std::string& ldrParameters)
+static bool ProcessLDRInstruction(std::string& ldrParameters, uint16_t& ldrOpcode)
 {
 	for (size_t i = 0; i < ldrParameters.size(); i++)
 	{
@@ -1303,38 +1236,8 @@ static bool ProcessLDRInstruction(std::string& ldrParameters)
 		if (immediate < 0 || immediate > 31)
 			return false;
 
-		ldrParameters.clear();
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-
-		if (immediate & 16)
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 8)
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 4)
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 2)
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (immediate & 1)
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
+		ldrOpcode = 0b0110100000000000;
+		ldrOpcode |= immediate << 6;
 	}
 	else if (ldrParameters[6] == 'R')
 	{
@@ -1349,105 +1252,55 @@ static bool ProcessLDRInstruction(std::string& ldrParameters)
 
 		char Rm = ldrParameters[7] - '0';
 
-		ldrParameters.clear();
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rm & 4)
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rm & 2)
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-		if (Rm & 1)
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-		else
-			ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
+		ldrOpcode = 0b0101100000000000;
+		ldrOpcode |= Rm << 6;
 	}
 	else
 	{
 		return false;
 	}
 
-	if (Rn & 4)
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rn & 2)
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rn & 1)
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 4)
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 2)
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 1)
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
+	ldrOpcode |= Rn << 3;
+	ldrOpcode |= Rd;
 	return true;
 }
 
-static bool ProcessLDRBInstruction(std::string& ldrbParameters)
+static bool ProcessLDRBInstruction(std::string& ldrbParameters, uint16_t& ldrbOpcode)
 {
-	if (!ProcessLDRInstruction(ldrbParameters))
+	if (!ProcessLDRInstruction(ldrbParameters, ldrbOpcode))
 		return false;
 
-	if (ldrbParameters[2] == ASSEMBLER_OUTPUT_SYMBOL_1)
+	if (ldrbOpcode & 0b0010000000000000)
 	{
-		ldrbParameters[3] = ASSEMBLER_OUTPUT_SYMBOL_1;
+		ldrbOpcode |= 0b0001000000000000;
 	}
 	else
 	{
-		ldrbParameters[5] = ASSEMBLER_OUTPUT_SYMBOL_1;
+		ldrbOpcode |= 0b0000010000000000;
 	}
 
 	return true;
 }
 
-static bool ProcessLDRHInstruction(std::string& ldrhParameters)
+static bool ProcessLDRHInstruction(std::string& ldrhParameters, uint16_t& ldrhOpcode)
 {
-	if (!ProcessLDRInstruction(ldrhParameters))
+	if (!ProcessLDRInstruction(ldrhParameters, ldrhOpcode))
 		return false;
 
-	if (ldrhParameters[2] == ASSEMBLER_OUTPUT_SYMBOL_1)
+	if (ldrhOpcode & 0b0010000000000000)
 	{
-		ldrhParameters[0] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		ldrhParameters[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		ldrhParameters[2] = ASSEMBLER_OUTPUT_SYMBOL_0;
+		ldrhOpcode |= 0b1000000000000000;
+		ldrhOpcode &= ~0b0110000000000000;
 	}
 	else
 	{
-		ldrhParameters[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
+		ldrhOpcode |= 0b0000001000000000;
 	}
 
 	return true;
 }
 
-static bool ProcessLDRSBInstruction(std::string& ldrsbParameters)
+static bool ProcessLDRSBInstruction(std::string& ldrsbParameters, uint16_t& ldrsbOpcode)
 {
 	for (size_t i = 0; i < ldrsbParameters.size(); i++)
 	{
@@ -1516,142 +1369,87 @@ static bool ProcessLDRSBInstruction(std::string& ldrsbParameters)
 
 	char Rm = ldrsbParameters[7] - '0';
 
-	ldrsbParameters.clear();
-	ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-
-	if (Rm & 4)
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rm & 2)
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rm & 1)
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rn & 4)
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rn & 2)
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rn & 1)
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 4)
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 2)
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
-	if (Rd & 1)
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		ldrsbParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-
+	ldrsbOpcode = 0b0101011000000000;
+	ldrsbOpcode |= Rm << 6;
+	ldrsbOpcode |= Rn << 3;
+	ldrsbOpcode |= Rd;
 	return true;
 }
 
-static bool ProcessLDRSHInstruction(std::string& ldrshParameters)
+static bool ProcessLDRSHInstruction(std::string& ldrshParameters, uint16_t& ldrshOpcode)
 {
-	if (!ProcessLDRSBInstruction(ldrshParameters))
+	if (!ProcessLDRSBInstruction(ldrshParameters, ldrshOpcode))
 		return false;
 
-	ldrshParameters[4] = ASSEMBLER_OUTPUT_SYMBOL_1;
+	ldrshOpcode |= 0b0000100000000000;
 
 	return false;
 }
 
-static bool ProcessLSLInstruction(std::string& lslParameters)
+static bool ProcessLSLInstruction(std::string& lslParameters, uint16_t& lslOpcode)
 {
-	if (!ProcessASRInstruction(lslParameters))
+	if (!ProcessASRInstruction(lslParameters, lslOpcode))
 		return false;
 
-	if (lslParameters[1] == ASSEMBLER_OUTPUT_SYMBOL_0)
+	if (!(lslOpcode & 0b0100000000000000))
 	{
-		lslParameters[3] = ASSEMBLER_OUTPUT_SYMBOL_0;
+		lslOpcode &= ~0b0001000000000000;
 	}
 	else
 	{
-		lslParameters[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		lslParameters[8] = ASSEMBLER_OUTPUT_SYMBOL_1;
+		lslOpcode &= ~0b0000000100000000;
+		lslOpcode |= 0b0000000010000000;
 	}
 
 	return true;
 }
 
-static bool ProcessLSRInstruction(std::string& lsrParameters)
+static bool ProcessLSRInstruction(std::string& lsrParameters, uint16_t& lsrOpcode)
 {
-	if (!ProcessASRInstruction(lsrParameters))
+	if (!ProcessASRInstruction(lsrParameters, lsrOpcode))
 		return false;
 
-	if (lsrParameters[1] == ASSEMBLER_OUTPUT_SYMBOL_0)
+	if (!(lsrOpcode & 0b0100000000000000))
 	{
-		lsrParameters[3] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		lsrParameters[4] = ASSEMBLER_OUTPUT_SYMBOL_1;
+		lsrOpcode &= ~0b0001000000000000;
+		lsrOpcode |= 0b0000100000000000;
 	}
 	else
 	{
-		lsrParameters[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		lsrParameters[8] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		lsrParameters[9] = ASSEMBLER_OUTPUT_SYMBOL_1;
+		lsrOpcode &= ~0b0000000100000000;
+		lsrOpcode |= 0b0000000011000000;
 	}
 
 	return true;
 }
 
-static bool ProcessMOVInstruction(std::string& movParameters)
+static bool ProcessMOVInstruction(std::string& movParameters, uint16_t& movOpcode)
 {
-	if (!ProcessCMPInstruction(movParameters))
+	if (!ProcessCMPInstruction(movParameters, movOpcode))
 		return false;
 
-	if (movParameters[1] == ASSEMBLER_OUTPUT_SYMBOL_0)
+	if (!(movOpcode & 0b0100000000000000))
 	{
-		movParameters[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
+		movOpcode &= ~0b0000100000000000;
 	}
 	else
 	{
-		if (movParameters[5] == ASSEMBLER_OUTPUT_SYMBOL_0)
+		if (!(movOpcode & 0b0000010000000000))
 		{
-			movParameters[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-			movParameters[3] = ASSEMBLER_OUTPUT_SYMBOL_1;
-			movParameters[4] = ASSEMBLER_OUTPUT_SYMBOL_1;
-			movParameters[5] = ASSEMBLER_OUTPUT_SYMBOL_1;
-			movParameters[6] = ASSEMBLER_OUTPUT_SYMBOL_0;
-			movParameters[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
+			movOpcode &= ~0b0100001010000000;
+			movOpcode |= 0b0001110000000000;
 		}
 		else
 		{
-			movParameters[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-			movParameters[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
+			movOpcode |= 0b0000001000000000;
+			movOpcode &= ~0b0000000100000000;
 		}
 	}
 
 	return true;
 }
 
-static bool ProcessMOVAInstruction(std::string& movaParameters, uint64_t fileNumber, uint64_t instructionNumber)
+static bool ProcessMOVAInstruction(std::string& movaParameters, uint64_t fileNumber, uint64_t instructionNumber, std::vector<MovAddressInfo>& movAddressMap)
 {
 	for (size_t i = 0; i < movaParameters.size(); i++)
 	{
@@ -1693,158 +1491,144 @@ static bool ProcessMOVAInstruction(std::string& movaParameters, uint64_t fileNum
 	if (Rd > 7)
 		return false;
 
-	s_MovAddressMap.push_back({ movaParameters.substr(4, UINT64_MAX), Rd, fileNumber, instructionNumber });
-	movaParameters.clear();
-	for (size_t i = 0; i < 14 * 8; i++)
-	{
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		if (i % 16 == 0 && i != 0)
-			movaParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION);
-#endif
-
-		movaParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-	}
-
+	movAddressMap.push_back({ movaParameters.substr(4, UINT64_MAX), Rd, fileNumber, instructionNumber, ASSEMBLER_PLACEHOLDER_SIZE_MOV_ADDRESS, UINT64_MAX, 0 });
 	return true;
 }
 
-static bool ProcessMULInstruction(std::string& mulParameters)
+static bool ProcessMULInstruction(std::string& mulParameters, uint16_t& mulOpcode)
 {
-	if (!ProcessADCInstruction(mulParameters))
+	if (!ProcessADCInstruction(mulParameters, mulOpcode))
 		return false;
 
-	mulParameters[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
+	mulOpcode |= 0b0000001000000000;
 	return true;
 }
 
-static bool ProcessMVNInstruction(std::string& mvnParameters)
+static bool ProcessMVNInstruction(std::string& mvnParameters, uint16_t& mvnOpcode)
 {
-	if (!ProcessADCInstruction(mvnParameters))
+	if (!ProcessADCInstruction(mvnParameters, mvnOpcode))
 		return false;
 
-	mvnParameters[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-	mvnParameters[8] = ASSEMBLER_OUTPUT_SYMBOL_1;
+	mvnOpcode |= 0b0000001010000000;
 	return true;
 }
 
-static bool ProcessNEGInstruction(std::string& negParameters)
+static bool ProcessNEGInstruction(std::string& negParameters, uint16_t& negOpcode)
 {
-	if (!ProcessADCInstruction(negParameters))
+	if (!ProcessADCInstruction(negParameters, negOpcode))
 		return false;
 
-	negParameters[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-	negParameters[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
+	negOpcode |= 0b0000001000000000;
+	negOpcode &= ~0b0000000100000000;
 	return true;
 }
 
-static bool ProcessORRInstruction(std::string& orrParameters)
+static bool ProcessORRInstruction(std::string& orrParameters, uint16_t& orrOpcode)
 {
-	if (!ProcessADCInstruction(orrParameters))
+	if (!ProcessADCInstruction(orrParameters, orrOpcode))
 		return false;
 
-	orrParameters[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-	orrParameters[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
+	orrOpcode |= 0b0000001000000000;
+	orrOpcode &= ~0b0000000001000000;
 	return true;
 }
 
-static bool ProcessRORInstruction(std::string& rorParameters)
+static bool ProcessRORInstruction(std::string& rorParameters, uint16_t& rorOpcode)
 {
-	if (!ProcessADCInstruction(rorParameters))
+	if (!ProcessADCInstruction(rorParameters, rorOpcode))
 		return false;
 
-	rorParameters[8] = ASSEMBLER_OUTPUT_SYMBOL_1;
+	rorOpcode |= 0b0000000010000000;
 	return true;
 }
 
-static bool ProcessSBCInstruction(std::string& sbcParameters)
+static bool ProcessSBCInstruction(std::string& sbcParameters, uint16_t& sbcOpcode)
 {
-	if (!ProcessADCInstruction(sbcParameters))
+	if (!ProcessADCInstruction(sbcParameters, sbcOpcode))
 		return false;
 
-	sbcParameters[8] = ASSEMBLER_OUTPUT_SYMBOL_1;
-	sbcParameters[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
+	sbcOpcode |= 0b0000000010000000;
+	sbcOpcode &= ~0b0000000001000000;
 	return true;
 }
 
-static bool ProcessSTMIAInstruction(std::string& stmiaParameters)
+static bool ProcessSTMIAInstruction(std::string& stmiaParameters, uint16_t& stmiaOpcode)
 {
 	return false;
 }
 
-static bool ProcessSTRInstruction(std::string& strParameters)
+static bool ProcessSTRInstruction(std::string& strParameters, uint16_t& strOpcode)
 {
-	if (!ProcessLDRInstruction(strParameters))
+	if (!ProcessLDRInstruction(strParameters, strOpcode))
 		return false;
 
-	strParameters[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
+	strOpcode &= ~0b0000100000000000;
 
 	return true;
 }
 
-static bool ProcessSTRBInstruction(std::string& strbParameters)
+static bool ProcessSTRBInstruction(std::string& strbParameters, uint16_t& strbOpcode)
 {
-	if (!ProcessLDRInstruction(strbParameters))
+	if (!ProcessLDRInstruction(strbParameters, strbOpcode))
 		return false;
 
-	if (strbParameters[2] == ASSEMBLER_OUTPUT_SYMBOL_1)
+	if (strbOpcode & 0b0010000000000000)
 	{
-		strbParameters[3] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		strbParameters[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
+		strbOpcode |= 0b0001000000000000;
+		strbOpcode &= ~0b0000100000000000;
 	}
 	else
 	{
-		strbParameters[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		strbParameters[5] = ASSEMBLER_OUTPUT_SYMBOL_1;
+		strbOpcode &= ~0b0000100000000000;
+		strbOpcode |= 0b0000010000000000;
 	}
 
 	return true;
 }
 
-static bool ProcessSTRHInstruction(std::string& strhParameters)
+static bool ProcessSTRHInstruction(std::string& strhParameters, uint16_t& strhOpcode)
 {
-	if (!ProcessLDRInstruction(strhParameters))
+	if (!ProcessLDRInstruction(strhParameters, strhOpcode))
 		return false;
 
-	if (strhParameters[2] == ASSEMBLER_OUTPUT_SYMBOL_1)
+	if (strhOpcode & 0b0010000000000000)
 	{
-		strhParameters[0] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		strhParameters[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		strhParameters[2] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		strhParameters[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
+		strhOpcode |= 0b1000000000000000;
+		strhOpcode &= ~0b0110100000000000;
 	}
 	else
 	{
-		strhParameters[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		strhParameters[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
+		strhOpcode &= ~0b0000100000000000;
+		strhOpcode |= 0b0000001000000000;
 	}
 
 	return true;
 }
 
-static bool ProcessSUBInstruction(std::string& subParameters)
+static bool ProcessSUBInstruction(std::string& subParameters, uint16_t& subOpcode)
 {
-	if (!ProcessADDInstruction(subParameters))
+	if (!ProcessADDInstruction(subParameters, subOpcode))
 		return false;
 
-	if (subParameters[2] == ASSEMBLER_OUTPUT_SYMBOL_1)
-		subParameters[4] = ASSEMBLER_OUTPUT_SYMBOL_1;
+	if (subOpcode & 0b0010000000000000)
+		subOpcode |= 0b0000100000000000;
 	else
-		subParameters[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
+		subOpcode |= 0b0000001000000000;
 
 	return true;
 }
 
-static bool ProcessSUBSPInstruction(std::string& subspParameters)
+static bool ProcessSUBSPInstruction(std::string& subspParameters, uint16_t& subspOpcode)
 {
-	if (!ProcessADDSPInstruction(subspParameters))
+	if (!ProcessADDSPInstruction(subspParameters, subspOpcode))
 		return false;
 
-	subspParameters[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
+	subspOpcode &= ~0b0000000010000000;
 
 	return true;
 }
 
-static bool ProcessSWIInstruction(std::string& swiParameters)
+static bool ProcessSWIInstruction(std::string& swiParameters, uint16_t& swiOpcode)
 {
 	for (size_t i = 0; i < swiParameters.size(); i++)
 	{
@@ -1862,171 +1646,495 @@ static bool ProcessSWIInstruction(std::string& swiParameters)
 	if (interuptID < 0 || interuptID > 255)
 		return false;
 
-	swiParameters.clear();
-	swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
-	swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-
-	if (interuptID & 128)
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
+	swiOpcode = 0b1101111100000000;
+	swiOpcode |= interuptID;
+	return true;
+}
 
-	if (interuptID & 64)
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
+static bool ProcessTSTInstruction(std::string& tstParameters, uint16_t& tstOpcode)
+{
+	if (!ProcessADCInstruction(tstParameters, tstOpcode))
+		return false;
 
-	if (interuptID & 32)
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
+	tstOpcode |= 0b0000001000000000;
+	tstOpcode &= ~0b0000000101000000;
+	return true;
+}
 
-	if (interuptID & 16)
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
+//Sets "address" To The Address Named By A MEM_ Label, Or To UINT64_MAX When "label" Is Not One
+//Returns False If The Offset After The Memory Region Is Not A Valid Decimal Number
+static bool FindMemoryAddress(const std::string& label, uint64_t& address)
+{
+	static const std::pair<const char*, uint64_t> memoryRegions[] =
+	{
+		{ "MEM_BIOS", ASSEMBLER_MEM_BIOS },
+		{ "MEM_ERAM", ASSEMBLER_MEM_ERAM },
+		{ "MEM_IRAM", ASSEMBLER_MEM_IRAM },
+		{ "MEM_IO", ASSEMBLER_MEM_IO },
+		{ "MEM_PALETTE", ASSEMBLER_MEM_PALETTE },
+		{ "MEM_OPALETTE", ASSEMBLER_MEM_PALETTE + 512 },
+		{ "MEM_VRAM", ASSEMBLER_MEM_VRAM },
+		{ "MEM_OVRAM", ASSEMBLER_MEM_VRAM + 65536 },
+		{ "MEM_OAM", ASSEMBLER_MEM_OAM },
+		{ "MEM_ROM", ASSEMBLER_MEM_ROM }
+	};
+
+	address = UINT64_MAX;
+	for (const std::pair<const char*, uint64_t>& memoryRegion : memoryRegions)
+	{
+		size_t regionNameSize = std::char_traits<char>::length(memoryRegion.first);
+		if (label.compare(0, regionNameSize, memoryRegion.first) != 0)
+			continue;
 
-	if (interuptID & 8)
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
+		address = memoryRegion.second;
+		if (label.size() > regionNameSize)
+		{
+			int index = StringToDecimalInt(label.substr(regionNameSize));
+			if (!s_SuccessfulIntConversion || index < 0)
+				return false;
+			address += index;
+		}
+		return true;
+	}
+	return true;
+}
 
-	if (interuptID & 4)
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
+//Writes The Shortest Sequence Of MOV/LSL/NEG/ADD That Puts "value" In "destinationRegister" Into "opcodes"
+//Returns How Many Instructions It Took, Or 0 If It Would Take More Than ASSEMBLER_MAX_CONSTANT_SIZE
+static uint64_t SynthesizeConstant(uint32_t value, uint16_t destinationRegister, uint16_t* opcodes)
+{
+	//MOV Rd, #imm
+	if (value <= 0xFF)
+	{
+		opcodes[0] = (uint16_t)(0b0010000000000000 | (destinationRegister << 8) | value);
+		return 1;
+	}
 
-	if (interuptID & 2)
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
+	//MOV Rd, #imm
+	//LSL Rd, Rd, #shift
+	for (uint16_t shift = 1; shift < 32; shift++)
+	{
+		if ((value >> shift) <= 0xFF && ((value >> shift) << shift) == value)
+		{
+			opcodes[0] = (uint16_t)(0b0010000000000000 | (destinationRegister << 8) | (value >> shift));
+			opcodes[1] = (uint16_t)(0b0000000000000000 | (shift << 6) | (destinationRegister << 3) | destinationRegister);
+			return 2;
+		}
+	}
 
-	if (interuptID & 1)
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_1);
-	else
-		swiParameters.push_back(ASSEMBLER_OUTPUT_SYMBOL_0);
+	//MOV Rd, #imm
+	//NEG Rd, Rd
+	if ((uint32_t)(0 - value) <= 0xFF)
+	{
+		opcodes[0] = (uint16_t)(0b0010000000000000 | (destinationRegister << 8) | (0 - value));
+		opcodes[1] = (uint16_t)(0b0100001001000000 | (destinationRegister << 3) | destinationRegister);
+		return 2;
+	}
 
-	return true;
+	//MOV Rd, #imm
+	//LSL Rd, Rd, #shift
+	//ADD Rd, #imm
+	for (uint16_t shift = 1; shift < 32; shift++)
+	{
+		if ((value >> shift) <= 0xFF && (value - ((value >> shift) << shift)) <= 0xFF)
+		{
+			opcodes[0] = (uint16_t)(0b0010000000000000 | (destinationRegister << 8) | (value >> shift));
+			opcodes[1] = (uint16_t)(0b0000000000000000 | (shift << 6) | (destinationRegister << 3) | destinationRegister);
+			opcodes[2] = (uint16_t)(0b0011000000000000 | (destinationRegister << 8) | (value - ((value >> shift) << shift)));
+			return 3;
+		}
+	}
+
+	return 0;
 }
 
-static bool ProcessTSTInstruction(std::string& tstParameters)
+static uint64_t LiteralPoolSize(const LiteralPoolInfo& literalPool)
 {
-	if (!ProcessADCInstruction(tstParameters))
-		return false;
+	return (literalPool.skipped ? 1 : 0) + 1 + 2 * literalPool.amountOfEntries;
+}
 
-	tstParameters[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-	tstParameters[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-	tstParameters[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
-	return true;
+//Where Entry "entry" Of A Literal Pool Starting At "poolInstructionNumber" Ends Up, Code Starts Word Aligned So Even Instruction Numbers Are Word Aligned
+static uint64_t LiteralPoolEntryNumber(const LiteralPoolInfo& literalPool, uint64_t poolInstructionNumber, uint64_t entry)
+{
+	uint64_t firstEntryNumber = poolInstructionNumber + (literalPool.skipped ? 1 : 0);
+	if (firstEntryNumber % 2 != 0)
+		firstEntryNumber++;
+	return firstEntryNumber + 2 * entry;
 }
 
-static bool PreProcess(const std::filesystem::path& sourcePath, const std::filesystem::path& filePath, uint64_t fileNumber, const std::filesystem::path& intDir)
+//Places A Literal Pool Holding Every Pending Entry At "currentInstructionNumber", Returns How Many Instructions It Takes Up
+static uint64_t FlushLiteralPool(SourceFileInfo& sourceFile, uint64_t fileNumber, uint64_t& currentInstructionNumber, std::vector<std::string>& pendingLiteralPoolEntries, bool skipped)
 {
-	s_CurrentByteSequenceAlignment = 1;
+	if (pendingLiteralPoolEntries.empty())
+		return 0;
 
-	std::fstream inputStream;
-	std::fstream outputStream;
-	inputStream.open(filePath, std::ios::in | std::ios::binary);
-	if (!inputStream.is_open())
+	sourceFile.literalPoolMap.push_back({ fileNumber, currentInstructionNumber, pendingLiteralPoolEntries.size(), skipped });
+	uint64_t literalPoolSize = LiteralPoolSize(sourceFile.literalPoolMap.back());
+	sourceFile.section.insert(sourceFile.section.end(), literalPoolSize, 0);
+	currentInstructionNumber += literalPoolSize;
+	pendingLiteralPoolEntries.clear();
+	return literalPoolSize;
+}
+
+static constexpr MnemonicInfo s_Mnemonics[] =
+{
+	{ "ADC", ASSEMBLER_MNEMONIC_OPCODE, ProcessADCInstruction, 0, 0, false },
+	{ "ADD", ASSEMBLER_MNEMONIC_OPCODE, ProcessADDInstruction, 0, 0, false },
+	{ "ADDHI", ASSEMBLER_MNEMONIC_OPCODE, ProcessADDHIInstruction, 0, 0, false },
+	{ "ADDSP", ASSEMBLER_MNEMONIC_OPCODE, ProcessADDSPInstruction, 0, 0, false },
+	{ "AND", ASSEMBLER_MNEMONIC_OPCODE, ProcessANDInstruction, 0, 0, false },
+	{ "ASR", ASSEMBLER_MNEMONIC_OPCODE, ProcessASRInstruction, 0, 0, false },
+	{ "B", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_AL, ASSEMBLER_PLACEHOLDER_SIZE_BRANCH, true },
+	{ "BEQ", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_EQ, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BNE", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_NE, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BCS", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_CS_HS, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BHS", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_CS_HS, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BCC", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_CC_LO, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BLO", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_CC_LO, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BMI", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_MI, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BPL", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_PL, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BVS", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_VS, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BVC", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_VC, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BHI", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_HI, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BLS", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_LS, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BGE", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_GE, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BLT", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_LT, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BGT", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_GT, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BLE", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_LE, ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH, false },
+	{ "BAL", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_AL, ASSEMBLER_PLACEHOLDER_SIZE_BRANCH, true },
+	{ "BNV", ASSEMBLER_MNEMONIC_UNPREDICTABLE, nullptr, 0, 0, false },
+	{ "CALL", ASSEMBLER_MNEMONIC_BRANCH, nullptr, ASSEMBLER_BRANCH_LINK, ASSEMBLER_PLACEHOLDER_SIZE_LINK_BRANCH, false },
+	{ "RETURN", ASSEMBLER_MNEMONIC_NO_PARAMETERS, ProcessRETURNInstruction, 0, 0, true },
+	{ "BIC", ASSEMBLER_MNEMONIC_OPCODE, ProcessBICInstruction, 0, 0, false },
+	{ "CMN", ASSEMBLER_MNEMONIC_OPCODE, ProcessCMNInstruction, 0, 0, false },
+	{ "CMP", ASSEMBLER_MNEMONIC_OPCODE, ProcessCMPInstruction, 0, 0, false },
+	{ "XOR", ASSEMBLER_MNEMONIC_OPCODE, ProcessXORInstruction, 0, 0, false },
+	{ "LDMIA", ASSEMBLER_MNEMONIC_OPCODE, ProcessLDMIAInstruction, 0, 0, false },
+	{ "LDR", ASSEMBLER_MNEMONIC_OPCODE, ProcessLDRInstruction, 0, 0, false },
+	{ "LDRB", ASSEMBLER_MNEMONIC_OPCODE, ProcessLDRBInstruction, 0, 0, false },
+	{ "LDRH", ASSEMBLER_MNEMONIC_OPCODE, ProcessLDRHInstruction, 0, 0, false },
+	{ "LDRSB", ASSEMBLER_MNEMONIC_OPCODE, ProcessLDRSBInstruction, 0, 0, false },
+	{ "LDRSH", ASSEMBLER_MNEMONIC_OPCODE, ProcessLDRSHInstruction, 0, 0, false },
+	{ "LSL", ASSEMBLER_MNEMONIC_OPCODE, ProcessLSLInstruction, 0, 0, false },
+	{ "LSR", ASSEMBLER_MNEMONIC_OPCODE, ProcessLSRInstruction, 0, 0, false },
+	{ "MOV", ASSEMBLER_MNEMONIC_OPCODE, ProcessMOVInstruction, 0, 0, false },
+	{ "MOVA", ASSEMBLER_MNEMONIC_MOV_ADDRESS, nullptr, 0, 0, false },
+	{ "MUL", ASSEMBLER_MNEMONIC_OPCODE, ProcessMULInstruction, 0, 0, false },
+	{ "MVN", ASSEMBLER_MNEMONIC_OPCODE, ProcessMVNInstruction, 0, 0, false },
+	{ "NEG", ASSEMBLER_MNEMONIC_OPCODE, ProcessNEGInstruction, 0, 0, false },
+	{ "ORR", ASSEMBLER_MNEMONIC_OPCODE, ProcessORRInstruction, 0, 0, false },
+	{ "ROR", ASSEMBLER_MNEMONIC_OPCODE, ProcessRORInstruction, 0, 0, false },
+	{ "SBC", ASSEMBLER_MNEMONIC_OPCODE, ProcessSBCInstruction, 0, 0, false },
+	{ "STMIA", ASSEMBLER_MNEMONIC_OPCODE, ProcessSTMIAInstruction, 0, 0, false },
+	{ "STR", ASSEMBLER_MNEMONIC_OPCODE, ProcessSTRInstruction, 0, 0, false },
+	{ "STRB", ASSEMBLER_MNEMONIC_OPCODE, ProcessSTRBInstruction, 0, 0, false },
+	{ "STRH", ASSEMBLER_MNEMONIC_OPCODE, ProcessSTRHInstruction, 0, 0, false },
+	{ "SUB", ASSEMBLER_MNEMONIC_OPCODE, ProcessSUBInstruction, 0, 0, false },
+	{ "SUBSP", ASSEMBLER_MNEMONIC_OPCODE, ProcessSUBSPInstruction, 0, 0, false },
+	{ "SWI", ASSEMBLER_MNEMONIC_OPCODE, ProcessSWIInstruction, 0, 0, false },
+	{ "TST", ASSEMBLER_MNEMONIC_OPCODE, ProcessTSTInstruction, 0, 0, false },
+	{ "NOP", ASSEMBLER_MNEMONIC_NO_PARAMETERS, ProcessNOPInstruction, 0, 0, false }
+};
+
+//Open Addressing Over HashSymbolName, Filled In At Compile Time, UINT8_MAX Marks An Empty Slot
+static constexpr std::array<uint8_t, ASSEMBLER_MNEMONIC_TABLE_SIZE> BuildMnemonicTable()
+{
+	std::array<uint8_t, ASSEMBLER_MNEMONIC_TABLE_SIZE> mnemonicTable;
+	mnemonicTable.fill(UINT8_MAX);
+	for (size_t m = 0; m < std::size(s_Mnemonics); m++)
 	{
-		inputStream.close();
-		std::cout << "Could not open " << std::filesystem::relative(filePath, sourcePath) << std::endl;
-		return false;
+		uint64_t slot = HashSymbolName(s_Mnemonics[m].name) & (ASSEMBLER_MNEMONIC_TABLE_SIZE - 1);
+		while (mnemonicTable[slot] != UINT8_MAX)
+			slot = (slot + 1) & (ASSEMBLER_MNEMONIC_TABLE_SIZE - 1);
+		mnemonicTable[slot] = (uint8_t)m;
 	}
-	std::filesystem::path relativePath = std::filesystem::relative(filePath, sourcePath);
-	std::string preProcessedFileName = relativePath.string();
-#ifdef ASSEMBLER_CONFIG_DEBUG
-	preProcessedFileName[preProcessedFileName.size() - 3] = 't';
-	preProcessedFileName[preProcessedFileName.size() - 2] = 'x';
-	preProcessedFileName[preProcessedFileName.size() - 1] = 't';
-#endif
-#ifdef ASSEMBLER_CONFIG_RELEASE
-	preProcessedFileName[preProcessedFileName.size() - 3] = 'b';
-	preProcessedFileName[preProcessedFileName.size() - 2] = 'i';
-	preProcessedFileName[preProcessedFileName.size() - 1] = 'n';
-#endif
-	std::filesystem::create_directories(intDir / relativePath.parent_path());
-	outputStream.open(intDir / preProcessedFileName, std::ios::out | std::ios::binary);
+	return mnemonicTable;
+}
 
-	std::string mostRecentLabel;
-	uint64_t currentInstructionNumber = 0;
-	size_t currentLineNumber = 0;
-	std::string currentLine;
-	while (std::getline(inputStream, currentLine))
+static constexpr std::array<uint8_t, ASSEMBLER_MNEMONIC_TABLE_SIZE> s_MnemonicTable = BuildMnemonicTable();
+static_assert(std::size(s_Mnemonics) * 2 <= ASSEMBLER_MNEMONIC_TABLE_SIZE);
+
+//What Each Character Of A Byte Sequence Decodes To, Commas Were Already Turned Into Spaces
+#define ASSEMBLER_HEX_SPACE 0x10
+#define ASSEMBLER_HEX_INVALID 0xFF
+
+static constexpr std::array<uint8_t, 256> BuildHexDigitTable()
+{
+	std::array<uint8_t, 256> hexDigitTable;
+	hexDigitTable.fill(ASSEMBLER_HEX_INVALID);
+	for (uint8_t digit = 0; digit < 10; digit++)
+		hexDigitTable['0' + digit] = digit;
+	for (uint8_t digit = 0; digit < 6; digit++)
 	{
-		size_t i = 0;
-		size_t j = 0;
+		hexDigitTable['A' + digit] = digit + 10;
+		hexDigitTable['a' + digit] = digit + 10;
+	}
+	hexDigitTable[' '] = ASSEMBLER_HEX_SPACE;
+	return hexDigitTable;
+}
 
-		currentLineNumber++;
+static constexpr std::array<uint8_t, 256> s_HexDigitTable = BuildHexDigitTable();
 
-		//1. Get Rid Of Any Non-Printable Characters
-		//Use "i" as an index into "currentLine", Use "j" as the current size of "currentLine"
-		j = currentLine.size();
-		while (i < j)
+//Every Two Digits Make A Byte, Spaces Anywhere Are Skipped, "amountDigits" Is Odd If The Last Byte Only Got Half Its Digits
+//Returns false With "invalidDigitIndex" Set To The Index In "text" Of The First Character That Is Neither
+static bool DecodeHexBytes(std::string_view text, std::vector<char>& bytes, size_t& amountDigits, size_t& invalidDigitIndex)
+{
+	//There Can Not Be More Bytes Than Half The Characters, So The Output Only Has To Be Sized Once
+	bytes.resize(text.size() / 2);
+	char* output = bytes.data();
+	uint8_t highNibble = 0;
+	bool halfByte = false;
+	size_t i = 0;
+
+#ifdef ASSEMBLER_DECODE_HEX_WITH_SSE2
+	//Sixteen Characters At A Time, Chars Above 0x7F Are Negative And So Never Land In Any Range
+	for (; i + 16 <= text.size(); i += 16)
+	{
+		__m128i characters = _mm_loadu_si128((const __m128i*)(text.data() + i));
+		__m128i lowerCase = _mm_or_si128(characters, _mm_set1_epi8(0x20));
+		__m128i isDecimal = _mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(characters, _mm_set1_epi8('9' + 1)));
+		__m128i isLetter = _mm_and_si128(_mm_cmpgt_epi8(lowerCase, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lowerCase, _mm_set1_epi8('f' + 1)));
+		uint32_t digitMask = (uint32_t)_mm_movemask_epi8(_mm_or_si128(isDecimal, isLetter));
+		uint32_t spaceMask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(characters, _mm_set1_epi8(' ')));
+		if ((digitMask | spaceMask) != 0xFFFF)
 		{
-			if (currentLine[i] < ' ')
-			{
-				currentLine.erase(i, 1);
-				j--;
-			}
-			else
-			{
-				i++;
-			}
+			invalidDigitIndex = i + std::countr_zero(~(digitMask | spaceMask));
+			return false;
 		}
 
-		//2. Delete All Comments
-		//Use "i" as an index into "currentLine", Use "j" as a count of the amount of consecutive '/' chars that have been seen
-		i = 0;
-		j = 0;
-		for (; i < currentLine.size(); i++)
+		//With The First Digit Of Each Byte In The Low Half Of A 16 Bit Lane, Every Lane Holding Two Digits Becomes One Byte
+		__m128i values = _mm_or_si128(_mm_and_si128(isDecimal, _mm_sub_epi8(characters, _mm_set1_epi8('0'))), _mm_andnot_si128(isDecimal, _mm_sub_epi8(lowerCase, _mm_set1_epi8('a' - 10))));
+		__m128i pairs = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(values, 4), _mm_set1_epi16(0x00F0)), _mm_srli_epi16(values, 8));
+		if (digitMask == 0xFFFF && !halfByte)
 		{
-			if (currentLine[i] == '/')
-				j++;
-			else
-				j = 0;
-
-			if (j == 2)
-			{
-				j = i;
-				j++;
-				i = currentLine.size();
-			}
+			_mm_storel_epi64((__m128i*)output, _mm_packus_epi16(pairs, pairs));
+			output += 8;
+			continue;
+		}
+		if (digitMask == 0x3333 && !halfByte)
+		{
+			//"XX, XX, XX, XX, " Is Four Bytes, Each In The Low Lane Of A 32 Bit Lane
+			__m128i words = _mm_packs_epi32(_mm_and_si128(pairs, _mm_set1_epi32(0xFFFF)), _mm_setzero_si128());
+			uint32_t fourBytes = (uint32_t)_mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+			std::memcpy(output, &fourBytes, 4);
+			output += 4;
+			continue;
 		}
-		if (j >= 2)
-			currentLine.erase(j - 2, UINT64_MAX);
-
 
-		//3. Replace All Commas With Spaces
-		//Use "i" as an index into "currentLine"
-		for (i = 0; i < currentLine.size(); i++)
+		alignas(16) uint8_t digitValues[16];
+		_mm_store_si128((__m128i*)digitValues, values);
+		for (; digitMask != 0; digitMask &= digitMask - 1)
 		{
-			if (currentLine[i] == ',')
-				currentLine[i] = ' ';
+			uint8_t digit = digitValues[std::countr_zero(digitMask)];
+			if (halfByte)
+				*output++ = (char)((highNibble << 4) | digit);
+			else
+				highNibble = digit;
+			halfByte = !halfByte;
 		}
+	}
+#endif
 
-		//4. Process Preprocessor Directives
-		//Use "i" and "j" for a variety of things
-		j = 0;
-		i = currentLine.find('~');
-		if (i != std::string::npos)
+	for (; i < text.size(); i++)
+	{
+		uint8_t digit = s_HexDigitTable[(uint8_t)text[i]];
+		if (digit == ASSEMBLER_HEX_SPACE)
+			continue;
+		if (digit == ASSEMBLER_HEX_INVALID)
 		{
-			i++;
+			invalidDigitIndex = i;
+			return false;
+		}
+		if (halfByte)
+			*output++ = (char)((highNibble << 4) | digit);
+		else
+			highNibble = digit;
+		halfByte = !halfByte;
+	}
+
+	amountDigits = (size_t)(output - bytes.data()) * 2 + halfByte;
+	bytes.resize((size_t)(output - bytes.data()));
+	return true;
+}
+
+//"currentLine" Has Lost Its Label, Leading Spaces And Control Characters By Step 7, So Count Through The Source Line
+//To Find The Column Of The Character "index" Characters After The Opening Curly Bracket Of A Byte Sequence
+static size_t ByteSequenceColumn(std::string_view sourceLine, size_t index)
+{
+	size_t labelEnd = sourceLine.find(':');
+	size_t position = sourceLine.find('{', (labelEnd == std::string_view::npos ? 0 : labelEnd + 1));
+	if (position == std::string_view::npos)
+		return 0;
+	while (++position < sourceLine.size())
+	{
+		if (sourceLine[position] < ' ')
+			continue;
+		if (index == 0)
+			break;
+		index--;
+	}
+	return position + 1;
+}
+
+static const MnemonicInfo* FindMnemonic(std::string_view name)
+{
+	for (uint64_t slot = HashSymbolName(name) & (ASSEMBLER_MNEMONIC_TABLE_SIZE - 1); s_MnemonicTable[slot] != UINT8_MAX; slot = (slot + 1) & (ASSEMBLER_MNEMONIC_TABLE_SIZE - 1))
+	{
+		if (s_Mnemonics[s_MnemonicTable[slot]].name == name)
+			return &s_Mnemonics[s_MnemonicTable[slot]];
+	}
+	return nullptr;
+}
+
+static bool LoadSourceText(const std::filesystem::path& filePath, SourceTextInfo& sourceText)
+{
+#ifdef ASSEMBLER_MAP_SOURCE_FILES
+	int fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+	if (fileDescriptor == -1)
+		return false;
+
+	struct stat fileStatus;
+	if (fstat(fileDescriptor, &fileStatus) == 0 && fileStatus.st_size > 0)
+	{
+		void* mapping = mmap(nullptr, (size_t)fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+		if (mapping != MAP_FAILED)
+		{
+			madvise(mapping, (size_t)fileStatus.st_size, MADV_SEQUENTIAL);
+			::close(fileDescriptor);
+			sourceText.mapping = mapping;
+			sourceText.text = (const char*)mapping;
+			sourceText.size = (size_t)fileStatus.st_size;
+			return true;
+		}
+	}
+	::close(fileDescriptor);
+#endif
+
+	//Empty Files Can Not Be Mapped, And Not Every System Can Map Files
+	std::ifstream inputStream(filePath, std::ios::in | std::ios::binary);
+	if (!inputStream.is_open())
+		return false;
+	inputStream.seekg(0, std::ios::end);
+	sourceText.buffer.resize((size_t)inputStream.tellg());
+	inputStream.seekg(0, std::ios::beg);
+	inputStream.read(sourceText.buffer.data(), sourceText.buffer.size());
+	sourceText.text = sourceText.buffer.data();
+	sourceText.size = sourceText.buffer.size();
+	return true;
+}
+
+//Written To One Side First So An Interrupted Run Never Leaves Half A File Behind
+//Every Write Gets Its Own Temporary File, So Threads Or Runs Writing The Same File At Once Never Write Into Each Other's
+static bool WriteFileAtomically(const std::filesystem::path& filePath, std::string_view contents)
+{
+	static const uint64_t runToken = ((uint64_t)std::random_device()() << 32) | std::random_device()();
+	static std::atomic<uint64_t> writeCount = 0;
+	std::ostringstream temporarySuffix;
+	temporarySuffix << "." << std::hex << runToken << "-" << writeCount++ << ".tmp";
+	std::filesystem::path temporaryPath = filePath;
+	temporaryPath += temporarySuffix.str();
+	std::fstream outputStream;
+	outputStream.open(temporaryPath, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!outputStream.is_open())
+		return false;
+	outputStream.write(contents.data(), contents.size());
+	outputStream.close();
+	std::error_code renameError;
+	if (outputStream)
+		std::filesystem::rename(temporaryPath, filePath, renameError);
+	if (!outputStream || renameError)
+	{
+		std::error_code removeError;
+		std::filesystem::remove(temporaryPath, removeError);
+		return false;
+	}
+	return true;
+}
+
+//Only Touches "sourceFile" And Thread-Local State, So Several Files Can Be PreProcessed At Once
+static bool PreProcess(const std::filesystem::path& sourcePath, SourceFileInfo& sourceFile, uint64_t fileNumber)
+{
+	s_CurrentByteSequenceAlignment = 1;
+	s_CurrentByteSequenceCompression = ASSEMBLER_COMPRESSION_NONE;
+
+	const std::filesystem::path& filePath = sourceFile.path;
+	std::vector<uint16_t>& section = sourceFile.section;
+	std::ostringstream& log = sourceFile.log;
+
+	SourceTextInfo sourceText;
+	if (!LoadSourceText(filePath, sourceText))
+	{
+		log << "Could not open " << std::filesystem::relative(filePath, sourcePath) << std::endl;
+		return false;
+	}
+	std::filesystem::path relativePath = std::filesystem::relative(filePath, sourcePath);
+	sourceFile.stats.bytesRead += sourceText.size;
+
+#ifdef ASSEMBLER_WRITE_BIT_LISTING
+	std::string listingFileName = relativePath.string();
+	listingFileName[listingFileName.size() - 3] = 't';
+	listingFileName[listingFileName.size() - 2] = 'x';
+	listingFileName[listingFileName.size() - 1] = 't';
+	std::error_code listingError;
+	std::filesystem::create_directories(s_ListingPath / relativePath.parent_path(), listingError);
+	std::fstream listingStream;
+	listingStream.open(s_ListingPath / listingFileName, std::ios::out | std::ios::binary);
+#endif
+
+	std::string mostRecentLabel;
+	uint64_t currentInstructionNumber = 0;
+	size_t currentLineNumber = 0;
+	std::vector<std::string> pendingLiteralPoolEntries;
+	bool previousInstructionWasUnconditional = false;
+	std::string currentLine;
+	size_t lineStart = 0;
+	while (lineStart < sourceText.size)
+	{
+		size_t i = 0;
+		size_t j = 0;
+
+		currentLineNumber++;
+
+		const char* lineEnd = (const char*)std::memchr(sourceText.text + lineStart, '\n', sourceText.size - lineStart);
+		size_t lineSize = (lineEnd == nullptr ? sourceText.size : (size_t)(lineEnd - sourceText.text)) - lineStart;
+		std::string_view sourceLine(sourceText.text + lineStart, lineSize);
+		lineStart += lineSize + 1;
+
+		//1. Get Rid Of Any Non-Printable Characters
+		//2. Delete All Comments
+		//3. Replace All Commas With Spaces
+		//All Done In One Pass While Copying The Line Out Of The Source Text
+		currentLine.clear();
+		for (char c : sourceLine)
+		{
+			if (c < ' ')
+				continue;
+
+			if (c == '/' && !currentLine.empty() && currentLine.back() == '/')
+			{
+				currentLine.pop_back();
+				break;
+			}
+
+			currentLine.push_back(c == ',' ? ' ' : c);
+		}
+
+		//4. Process Preprocessor Directives
+		//Use "i" and "j" for a variety of things
+		bool lineIncludesBinary = false;
+		ByteSequenceInfo includedByteSequence = {};
+		j = 0;
+		i = currentLine.find('~');
+		if (i != std::string::npos)
+		{
+			i++;
 			if (i == currentLine.find("join"))
 			{
 				i += 4;
 				if (i == currentLine.size())
 				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The ~join Preprocessor Directive On This Line Does Not Have A File Path To Join Associated With It" << std::endl;
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~join Preprocessor Directive On This Line Does Not Have A File Path To Join Associated With It" << std::endl;
 					return false;
 				}
 				while (i < currentLine.size())
@@ -2041,18 +2149,14 @@ static bool PreProcess(const std::filesystem::path& sourcePath, const std::files
 				}
 				if (j == 0)
 				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The ~join Preprocessor Directive On This Line Does Not Have A File Path To Join Associated With It" << std::endl;
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~join Preprocessor Directive On This Line Does Not Have A File Path To Join Associated With It" << std::endl;
 					return false;
 				}
 				if (currentLine[j] != '"')
 				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The ~join Preprocessor Directive On This Line Does Not Have A File Path (In Inverted Commas) To Join Associated With It" << std::endl;
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~join Preprocessor Directive On This Line Does Not Have A File Path (In Inverted Commas) To Join Associated With It" << std::endl;
 					return false;
 				}
 				j++;
@@ -2067,10 +2171,8 @@ static bool PreProcess(const std::filesystem::path& sourcePath, const std::files
 				}
 				if (j == currentLine.size())
 				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The ~join Preprocessor Directive On This Line Does Not Have A File Path (In Inverted Commas) To Join Associated With It" << std::endl;
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~join Preprocessor Directive On This Line Does Not Have A File Path (In Inverted Commas) To Join Associated With It" << std::endl;
 					return false;
 				}
 				j = currentLine.find('"');
@@ -2080,36 +2182,15 @@ static bool PreProcess(const std::filesystem::path& sourcePath, const std::files
 				currentLine.erase(j, i - j + 1);
 				if (!std::filesystem::exists(joinFilePath))
 				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The ~join Preprocessor Directive On This Line Provides A File Path That Does Not Exist" << std::endl;
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~join Preprocessor Directive On This Line Provides A File Path That Does Not Exist" << std::endl;
 					return false;
 				}
-				i = 0;
-				s_JoinMap.emplace_back(fileNumber, 0);
-				for (const auto& dirEntry : std::filesystem::recursive_directory_iterator(sourcePath))
-				{
-					if (dirEntry.is_directory())
-						goto dontChange;
-
-					if (dirEntry.path().extension().string() != ".asm")
-						goto dontChange;
-
-					if (dirEntry.path() == joinFilePath)
-						s_JoinMap.back().childFile = i;
-
-					goto Change;
-
-					dontChange: i--;
-					Change: i++;
-				}
-				if (s_JoinMap.back().parentFile == s_JoinMap.back().childFile)
+				sourceFile.joinPaths.push_back(std::filesystem::relative(joinFilePath, sourcePath).generic_string());
+				if (sourceFile.joinPaths.back() == relativePath.generic_string())
 				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The ~join Preprocessor Directive On This Line Provides A File Path That Is The Same As The File It Was Found In" << std::endl;
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~join Preprocessor Directive On This Line Provides A File Path That Is The Same As The File It Was Found In" << std::endl;
 					return false;
 				}
 			}
@@ -2118,10 +2199,8 @@ static bool PreProcess(const std::filesystem::path& sourcePath, const std::files
 				i += 5;
 				if (currentLine.size() < i + 1)
 				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The ~align Preprocessor Directive On This Line Has Incorrect Syntax" << std::endl;
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~align Preprocessor Directive On This Line Has Incorrect Syntax" << std::endl;
 					return false;
 				}
 				while (i < currentLine.size())
@@ -2136,18 +2215,14 @@ static bool PreProcess(const std::filesystem::path& sourcePath, const std::files
 				}
 				if (j == 0)
 				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The ~align Preprocessor Directive On This Line Does Not Have A Valid Alignment Number Associated With It" << std::endl;
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~align Preprocessor Directive On This Line Does Not Have A Valid Alignment Number Associated With It" << std::endl;
 					return false;
 				}
 				if (currentLine[j] != '"')
 				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The ~align Preprocessor Directive On This Line Does Not Have A Valid Alignment Number (In Inverted Commas) Associated With It" << std::endl;
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~align Preprocessor Directive On This Line Does Not Have A Valid Alignment Number (In Inverted Commas) Associated With It" << std::endl;
 					return false;
 				}
 				j++;
@@ -2162,28 +2237,22 @@ static bool PreProcess(const std::filesystem::path& sourcePath, const std::files
 				}
 				if (j == currentLine.size())
 				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The ~align Preprocessor Directive On This Line Does Not Have A Valid Alignment Number (In Inverted Commas) Associated With It" << std::endl;
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~align Preprocessor Directive On This Line Does Not Have A Valid Alignment Number (In Inverted Commas) Associated With It" << std::endl;
 					return false;
 				}
 				j = currentLine.find('"');
 				int alignmentNumber = StringToDecimalInt(currentLine.substr(j + 1, i - j - 1));
 				if (!s_SuccessfulIntConversion)
 				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The ~align Preprocessor Directive On This Line Does Not Have A Valid Alignment Number Associated With It" << std::endl;
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~align Preprocessor Directive On This Line Does Not Have A Valid Alignment Number Associated With It" << std::endl;
 					return false;
 				}
 				if (alignmentNumber < 0 || alignmentNumber > 255)
 				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The ~align Preprocessor Directive On This Line Does Not Have A Valid Alignment Number Associated With It" << std::endl;
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~align Preprocessor Directive On This Line Does Not Have A Valid Alignment Number Associated With It" << std::endl;
 					return false;
 				}
 				uint64_t alignment = 1;
@@ -2197,12 +2266,110 @@ static bool PreProcess(const std::filesystem::path& sourcePath, const std::files
 				j = currentLine.find('~');
 				currentLine.erase(j, i - j + 1);
 			}
+			else if (i == currentLine.find("incbin"))
+			{
+				//The Rest Of The Line Belongs To ~incbin: A File Path In Inverted Commas, Then Optionally [Offset, Length]
+				i += 6;
+				j = currentLine.find('"', i);
+				size_t pathEnd = (j == std::string::npos ? std::string::npos : currentLine.find('"', j + 1));
+				if (j == std::string::npos || pathEnd == std::string::npos || currentLine.find_first_not_of(' ', i) != j)
+				{
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~incbin Preprocessor Directive On This Line Does Not Have A File Path (In Inverted Commas) To Include Associated With It" << std::endl;
+					return false;
+				}
+				std::filesystem::path includedFilePath = sourcePath / currentLine.substr(j + 1, pathEnd - j - 1);
+				std::error_code includedFileError;
+				if (!std::filesystem::is_regular_file(includedFilePath, includedFileError))
+				{
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~incbin Preprocessor Directive On This Line Provides A File Path That Does Not Exist" << std::endl;
+					return false;
+				}
+				includedByteSequence.includedPath = std::filesystem::relative(includedFilePath, sourcePath).generic_string();
+				includedByteSequence.includedFileSize = std::filesystem::file_size(includedFilePath, includedFileError);
+				includedByteSequence.includedOffset = 0;
+				includedByteSequence.includedSize = includedByteSequence.includedFileSize;
+
+				std::string range = currentLine.substr(pathEnd + 1);
+				size_t rangeStart = range.find_first_not_of(' ');
+				if (rangeStart != std::string::npos)
+				{
+					size_t rangeEnd = range.find_last_not_of(' ');
+					std::vector<std::string> rangeNumbers;
+					if (rangeEnd > rangeStart && range[rangeStart] == '[' && range[rangeEnd] == ']')
+					{
+						std::istringstream rangeStream(range.substr(rangeStart + 1, rangeEnd - rangeStart - 1));
+						for (std::string rangeNumber; rangeStream >> rangeNumber;)
+							rangeNumbers.push_back(rangeNumber);
+					}
+
+					bool validRange = (rangeNumbers.size() == 1 || rangeNumbers.size() == 2) && StringToFileOffset(rangeNumbers[0], includedByteSequence.includedOffset);
+					if (validRange && rangeNumbers.size() == 2)
+						validRange = StringToFileOffset(rangeNumbers[1], includedByteSequence.includedSize);
+					else
+						includedByteSequence.includedSize = includedByteSequence.includedFileSize - std::min(includedByteSequence.includedOffset, includedByteSequence.includedFileSize);
+					if (!validRange)
+					{
+						log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+						log << "The ~incbin Preprocessor Directive On This Line Does Not Have A Valid [Offset, Length] Associated With It" << std::endl;
+						return false;
+					}
+				}
+				if (includedByteSequence.includedOffset > includedByteSequence.includedFileSize || includedByteSequence.includedSize > includedByteSequence.includedFileSize - includedByteSequence.includedOffset)
+				{
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~incbin Preprocessor Directive On This Line Reaches Past The End Of " << includedByteSequence.includedPath << ", Which Is " << includedByteSequence.includedFileSize << " Bytes Long" << std::endl;
+					return false;
+				}
+
+				includedByteSequence.alignment = s_CurrentByteSequenceAlignment;
+				includedByteSequence.compression = s_CurrentByteSequenceCompression;
+				lineIncludesBinary = true;
+				currentLine.erase(currentLine.find('~'));
+			}
+			else if (i == currentLine.find("compress"))
+			{
+				//Applies To Every Byte Sequence And ~incbin After It In The File, Until The Next ~compress
+				i += 8;
+				j = currentLine.find_first_not_of(' ', i);
+				size_t formatEnd = (j == std::string::npos ? std::string::npos : currentLine.find(' ', j));
+				std::string format = (j == std::string::npos || j == i ? std::string() : currentLine.substr(j, formatEnd - j));
+				if (format.size() >= 2 && format.front() == '"' && format.back() == '"')
+					format = format.substr(1, format.size() - 2);
+
+				if (format == "lz77")
+					s_CurrentByteSequenceCompression = ASSEMBLER_COMPRESSION_LZ77;
+				else if (format == "rle")
+					s_CurrentByteSequenceCompression = ASSEMBLER_COMPRESSION_RLE;
+				else if (format == "huffman")
+					s_CurrentByteSequenceCompression = ASSEMBLER_COMPRESSION_HUFFMAN;
+				else if (format == "none")
+					s_CurrentByteSequenceCompression = ASSEMBLER_COMPRESSION_NONE;
+				else
+				{
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The ~compress Preprocessor Directive On This Line Does Not Have A Valid Format (lz77, rle, huffman Or none) Associated With It" << std::endl;
+					return false;
+				}
+				j = currentLine.find('~');
+				currentLine.erase(j, (formatEnd == std::string::npos ? currentLine.size() : formatEnd) - j);
+			}
+			else if (i == currentLine.find("pool"))
+			{
+				//Execution Is Branched Around The Pool Unless The Previous Instruction Never Falls Through
+				j = currentLine.find('~');
+				currentLine.erase(j, 5);
+#ifdef ASSEMBLER_WRITE_BIT_LISTING
+				WritePlaceholderListing(listingStream, FlushLiteralPool(sourceFile, fileNumber, currentInstructionNumber, pendingLiteralPoolEntries, !previousInstructionWasUnconditional));
+#else
+				FlushLiteralPool(sourceFile, fileNumber, currentInstructionNumber, pendingLiteralPoolEntries, !previousInstructionWasUnconditional);
+#endif
+			}
 			else
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The Preprocessor Directive On This Line Is Not A Recognised Directive" << std::endl;
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The Preprocessor Directive On This Line Is Not A Recognised Directive" << std::endl;
 				return false;
 			}
 		}
@@ -2227,34 +2394,26 @@ static bool PreProcess(const std::filesystem::path& sourcePath, const std::files
 			{
 				if (currentLine[i] == ' ')
 				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The Label On This Line Contains Spaces Which Is Not Valid" << std::endl;
+					log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+					log << "The Label On This Line Contains Spaces Which Is Not Valid" << std::endl;
 					return false;
 				}
 			}
 			mostRecentLabel = currentLine.substr(0, j);
 			if (mostRecentLabel.empty())
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The Label On This Line Must Contain Printable Characters" << std::endl;
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The Label On This Line Must Contain Printable Characters" << std::endl;
 				return false;
 			}
-			for (i = 0; i < s_LabelMap.size(); i++)
+			if (!AddSymbol(sourceFile.symbolTable, mostRecentLabel, ASSEMBLER_SYMBOL_LABEL, sourceFile.labelMap.size()))
 			{
-				if (s_LabelMap[i].label == mostRecentLabel)
-				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The Label On This Line Is Already Defined" << std::endl;
-					return false;
-				}
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The Label On This Line Is Already Defined" << std::endl;
+				return false;
 			}
-			s_LabelMap.push_back({ mostRecentLabel, fileNumber, currentInstructionNumber });
+			sourceFile.symbolDefinitions.push_back({ mostRecentLabel, currentLineNumber });
+			sourceFile.labelMap.push_back({ fileNumber, currentInstructionNumber });
 			j++;
 			currentLine.erase(0, j);
 			j = 0;
@@ -2272,121 +2431,83 @@ static bool PreProcess(const std::filesystem::path& sourcePath, const std::files
 		}
 		currentLine.erase(0, j);
 
+		//Process The Included Binary File If There Is One, Which Is A Byte Sequence Whose Bytes Stay In The File
+		if (lineIncludesBinary)
+		{
+			if (currentLine.find_first_not_of(' ') != std::string::npos)
+			{
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The ~incbin Preprocessor Directive On This Line Can Only Come After A Label" << std::endl;
+				return false;
+			}
+
+			//The Label Has To Be The Last One Found, With No Instructions Since, Or It Already Names Something Else
+			SymbolInfo* symbol = (mostRecentLabel.empty() ? nullptr : FindSymbol(sourceFile.symbolTable, mostRecentLabel));
+			if (symbol == nullptr || symbol->type != ASSEMBLER_SYMBOL_LABEL || symbol->index + 1 != sourceFile.labelMap.size() || sourceFile.labelMap.back().instructionNumber != currentInstructionNumber)
+			{
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The ~incbin Preprocessor Directive On This Line Does Not Have A Label To Identify It" << std::endl;
+				return false;
+			}
+
+			symbol->type = ASSEMBLER_SYMBOL_BYTE_SEQUENCE;
+			symbol->index = sourceFile.byteSequenceMap.size();
+			sourceFile.labelMap.pop_back();
+			sourceFile.byteSequenceMap.push_back(std::move(includedByteSequence));
+			continue;
+		}
+
 		//If Line Is Empty, Ignore
 		if (currentLine.size() == 0)
 			continue;
 
 		//7. Process The Byte Sequence If There Is One
-		//Use "i" as an index into "currentLine", Use "j" as the current size of "currentLine" AND LATER Use "j" to know which hexadecimal digit you are on
+		//Use "i" as the index of the ending curly bracket, Use "j" as the amount of hexadecimal digits
 		if (currentLine[0] == '{')
 		{
-			currentLine.erase(0, 1);
-			i = 0;
-			j = currentLine.size();
-			while (i < j)
-			{
-				if (currentLine[i] == ' ')
-				{
-					currentLine.erase(i, 1);
-					j--;
-				}
-				else
-				{
-					i++;
-				}
-			}
-
-			if (currentLine.back() != '}')
+			i = currentLine.find_last_not_of(' ');
+			if (i == 0 || currentLine[i] != '}')
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The Byte Sequence On This Line Does Not Have An Ending Curly Bracket" << std::endl;
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The Byte Sequence On This Line Does Not Have An Ending Curly Bracket" << std::endl;
 				return false;
 			}
-			currentLine.pop_back();
 
-			if ((currentLine.size() % 2) == 1)
+			if (mostRecentLabel.empty())
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The Byte Sequence On This Line Has Half A Byte Missing" << std::endl;
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The Byte Sequence On This Line Does Not Have A Label To Identify It" << std::endl;
 				return false;
 			}
 
-			if (mostRecentLabel.empty())
+			//The Label Was Recorded As An Instruction Label When It Was Found, So Turn It Into A Byte Sequence
+			SymbolInfo* symbol = FindSymbol(sourceFile.symbolTable, mostRecentLabel);
+			if (symbol->type != ASSEMBLER_SYMBOL_LABEL)
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The Byte Sequence On This Line Does Not Have A Label To Identify It" << std::endl;
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The Label That Identifies The Byte Sequence On This Line Is Already Defined" << std::endl;
 				return false;
 			}
 
-			for (i = 0; i < s_ByteSequenceMap.size(); i++)
+			ByteSequenceInfo byteSequence = { std::vector<char>(), s_CurrentByteSequenceAlignment, 0, s_CurrentByteSequenceCompression };
+			size_t invalidDigitIndex = 0;
+			if (!DecodeHexBytes(std::string_view(currentLine).substr(1, i - 1), byteSequence.bytes, j, invalidDigitIndex))
 			{
-				if (s_ByteSequenceMap[i].label == mostRecentLabel)
-				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The Label That Identifies The Byte Sequence On This Line Is Already Defined" << std::endl;
-					return false;
-				}
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The Byte Sequence On This Line Has An Invalid Hexadecimal Digit '" << currentLine[invalidDigitIndex + 1] << "' In Column " << ByteSequenceColumn(sourceLine, invalidDigitIndex) << std::endl;
+				return false;
 			}
-
-			s_LabelMap.pop_back();
-			s_ByteSequenceMap.push_back({ mostRecentLabel, std::vector<char>(), s_CurrentByteSequenceAlignment, 0 });
-
-			i = 0;
-			j = 0;
-			for (; i < currentLine.size(); i++)
+			if ((j % 2) == 1)
 			{
-				if (j == 0)
-				{
-					if (currentLine[i] >= '0' && currentLine[i] <= '9')
-					{
-						s_ByteSequenceMap.back().bytes.push_back((currentLine[i] - '0') << 4);
-					}
-					else if (currentLine[i] >= 'A' && currentLine[i] <= 'F')
-					{
-						s_ByteSequenceMap.back().bytes.push_back(((currentLine[i] - 'A') + 10) << 4);
-					}
-					else
-					{
-						inputStream.close();
-						outputStream.close();
-						std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-						std::cout << "The Byte Sequence On This Line Has An Invalid Hexadecimal Digit" << std::endl;
-						return false;
-					}
-
-					j = 1;
-				}
-				else
-				{
-					if (currentLine[i] >= '0' && currentLine[i] <= '9')
-					{
-						s_ByteSequenceMap.back().bytes.back() += (currentLine[i] - '0');
-					}
-					else if (currentLine[i] >= 'A' && currentLine[i] <= 'F')
-					{
-						s_ByteSequenceMap.back().bytes.back() += ((currentLine[i] - 'A') + 10);
-					}
-					else
-					{
-						inputStream.close();
-						outputStream.close();
-						std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-						std::cout << "The Byte Sequence On This Line Has An Invalid Hexadecimal Digit" << std::endl;
-						return false;
-					}
-
-					j = 0;
-				}
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The Byte Sequence On This Line Has Half A Byte Missing" << std::endl;
+				return false;
 			}
 
+			symbol->type = ASSEMBLER_SYMBOL_BYTE_SEQUENCE;
+			symbol->index = sourceFile.byteSequenceMap.size();
+			sourceFile.labelMap.pop_back();
+			sourceFile.byteSequenceMap.push_back(std::move(byteSequence));
 			continue;
 		}
 
@@ -2411,10 +2532,8 @@ static bool PreProcess(const std::filesystem::path& sourcePath, const std::files
 			}
 			if (j == UINT64_MAX)
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The Pointer Sequence On This Line Does Not Have An Ending Square Bracket Or Has Invalid Syntax After The Ending Square Bracket" << std::endl;
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The Pointer Sequence On This Line Does Not Have An Ending Square Bracket Or Has Invalid Syntax After The Ending Square Bracket" << std::endl;
 				return false;
 			}
 
@@ -2422,43 +2541,40 @@ static bool PreProcess(const std::filesystem::path& sourcePath, const std::files
 
 			if (mostRecentLabel.empty())
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The Pointer Sequence On This Line Does Not Have A Label To Identify It" << std::endl;
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The Pointer Sequence On This Line Does Not Have A Label To Identify It" << std::endl;
 				return false;
 			}
 
-			for (i = 0; i < s_PtrSequenceMap.size(); i++)
+			//The Label Was Recorded As An Instruction Label When It Was Found, So Turn It Into A Pointer Sequence
+			SymbolInfo* symbol = FindSymbol(sourceFile.symbolTable, mostRecentLabel);
+			if (symbol->type != ASSEMBLER_SYMBOL_LABEL)
 			{
-				if (s_PtrSequenceMap[i].label == mostRecentLabel)
-				{
-					inputStream.close();
-					outputStream.close();
-					std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-					std::cout << "The Label That Identifies The Pointer Sequence On This Line Is Already Defined" << std::endl;
-					return false;
-				}
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The Label That Identifies The Pointer Sequence On This Line Is Already Defined" << std::endl;
+				return false;
 			}
 
-			s_LabelMap.pop_back();
-			s_PtrSequenceMap.push_back({ mostRecentLabel, std::vector<std::string>(), std::vector<char>(), 0 });
+			symbol->type = ASSEMBLER_SYMBOL_PTR_SEQUENCE;
+			symbol->index = sourceFile.ptrSequenceMap.size();
+			sourceFile.labelMap.pop_back();
+			sourceFile.ptrSequenceMap.push_back({ std::vector<std::string>(), std::vector<char>(), 0 });
 
 			i = 0;
 			j = 1;
-			s_PtrSequenceMap.back().pointers.emplace_back();
+			sourceFile.ptrSequenceMap.back().pointers.emplace_back();
 			for (; i < currentLine.size(); i++)
 			{
 				if (currentLine[i] == ' ')
 				{
 					if (j == 0)
-						s_PtrSequenceMap.back().pointers.emplace_back();
+						sourceFile.ptrSequenceMap.back().pointers.emplace_back();
 
 					j = 1;
 				}
 				else
 				{
-					s_PtrSequenceMap.back().pointers.back().push_back(currentLine[i]);
+					sourceFile.ptrSequenceMap.back().pointers.back().push_back(currentLine[i]);
 					j = 0;
 				}
 			}
@@ -2483,634 +2599,1471 @@ static bool PreProcess(const std::filesystem::path& sourcePath, const std::files
 		}
 
 		//10. Convert Instructions (except Branchs) Into Machine Code
-		std::string instruction = currentLine.substr(0, j);
+		const MnemonicInfo* mnemonic = FindMnemonic(std::string_view(currentLine).substr(0, j));
+		uint16_t opcode = 0;
+		uint64_t placeholderSize = 0;
+		uint16_t constantOpcodes[ASSEMBLER_MAX_CONSTANT_SIZE];
+		uint64_t amountOfConstantOpcodes = 0;
+		bool unconditional = false;
 		i = 0;
 		j = 0;
-		if (instruction == "ADC")
+		if (mnemonic == nullptr)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessADCInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The ADC Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+			log << "The Instruction On This Line Is Invalid" << std::endl;
+			return false;
 		}
-		else if (instruction == "ADD")
+		currentLine.erase(0, mnemonic->name.size());
+		unconditional = mnemonic->unconditional;
+		if (mnemonic->type == ASSEMBLER_MNEMONIC_OPCODE)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessADDInstruction(currentLine))
+			if (!mnemonic->processInstruction(currentLine, opcode))
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The ADD Instruction On This Line Has Invalid Parameters" << std::endl;
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The " << mnemonic->name << " Instruction On This Line Has Invalid Parameters" << std::endl;
 				return false;
 			}
 		}
-		else if (instruction == "ADDHI")
+		else if (mnemonic->type == ASSEMBLER_MNEMONIC_NO_PARAMETERS)
 		{
-			currentLine.erase(0, 5);
-			if (!ProcessADDHIInstruction(currentLine))
+			if (!mnemonic->processInstruction(currentLine, opcode))
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The ADDHI Instruction On This Line Has Invalid Parameters" << std::endl;
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The " << mnemonic->name << " Instruction On This Line Should Not Have Any Parameters" << std::endl;
 				return false;
 			}
 		}
-		else if (instruction == "ADDSP")
+		else if (mnemonic->type == ASSEMBLER_MNEMONIC_BRANCH)
 		{
-			currentLine.erase(0, 5);
-			if (!ProcessADDSPInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The ADDSP Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			placeholderSize = mnemonic->placeholderSize;
+			ProcessBranchInstruction({ mnemonic->branchType, fileNumber, currentInstructionNumber, currentLine, placeholderSize }, sourceFile.branchMap);
 		}
-		else if (instruction == "AND")
+		else if (mnemonic->type == ASSEMBLER_MNEMONIC_MOV_ADDRESS)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessANDInstruction(currentLine))
+			if (!ProcessMOVAInstruction(currentLine, fileNumber, currentInstructionNumber, sourceFile.movAddressMap))
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The AND Instruction On This Line Has Invalid Parameters" << std::endl;
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The MOVA Instruction On This Line Has Invalid Parameters" << std::endl;
 				return false;
 			}
-		}
-		else if (instruction == "ASR")
-		{
-			currentLine.erase(0, 3);
-			if (!ProcessASRInstruction(currentLine))
+			placeholderSize = ASSEMBLER_PLACEHOLDER_SIZE_MOV_ADDRESS;
+			MovAddressInfo& movAddress = sourceFile.movAddressMap.back();
+
+			//Memory Region Addresses Are Known Now, So Small Enough Ones Are Built Up Directly
+			uint64_t memoryAddress = UINT64_MAX;
+			if (!FindMemoryAddress(movAddress.label, memoryAddress))
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The ASR Instruction On This Line Has Invalid Parameters" << std::endl;
+				log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+				log << "The MOVA Instruction On This Line Has An Invalid Memory Region Offset" << std::endl;
 				return false;
 			}
+			if (memoryAddress != UINT64_MAX)
+				amountOfConstantOpcodes = SynthesizeConstant((uint32_t)memoryAddress, (uint16_t)movAddress.destinationRegister, constantOpcodes);
+			if (amountOfConstantOpcodes != 0)
+			{
+				sourceFile.movAddressMap.pop_back();
+				placeholderSize = 0;
+			}
+			else
+			{
+				//Give The Address An Entry In The Next Literal Pool, Sharing It With Earlier MOVAs Of The Same Label
+				size_t entry = 0;
+				while (entry < pendingLiteralPoolEntries.size() && pendingLiteralPoolEntries[entry] != movAddress.label)
+					entry++;
+				if (entry == pendingLiteralPoolEntries.size() && entry < ASSEMBLER_LITERAL_POOL_MAX_ENTRIES)
+					pendingLiteralPoolEntries.push_back(movAddress.label);
+				if (entry < pendingLiteralPoolEntries.size())
+				{
+					movAddress.literalPool = sourceFile.literalPoolMap.size();
+					movAddress.literalPoolEntry = entry;
+				}
+			}
 		}
-		else if (instruction == "B")
-		{
-			currentLine.erase(0, 1);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_AL, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			for (; i < ASSEMBLER_INSTRUCTION_CHAR_SIZE * 2; i++)
-				currentLine.pop_back();
-
-			currentInstructionNumber += 7;
-		}
-		else if (instruction == "BEQ")
-		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_EQ, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			currentInstructionNumber += 9;
-		}
-		else if (instruction == "BNE")
-		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_NE, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			currentInstructionNumber += 9;
-		}
-		else if (instruction == "BCS" || instruction == "BHS")
-		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_CS_HS, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			currentInstructionNumber += 9;
-		}
-		else if (instruction == "BCC" || instruction == "BLO")
-		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_CC_LO, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			currentInstructionNumber += 9;
-		}
-		else if (instruction == "BMI")
-		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_MI, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			currentInstructionNumber += 9;
-		}
-		else if (instruction == "BPL")
+		else
 		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_PL, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			currentInstructionNumber += 9;
+			log << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
+			log << "This Line Contains A " << mnemonic->name << " Instruction Which Will Give Unpredictable Results" << std::endl;
+			return false;
 		}
-		else if (instruction == "BVS")
+
+
+		//11. Put Instruction (Or Placeholder For A Relocation) In The Section
+		if (placeholderSize != 0)
 		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_VS, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			currentInstructionNumber += 9;
+			section.insert(section.end(), placeholderSize, 0);
+#ifdef ASSEMBLER_WRITE_BIT_LISTING
+			WritePlaceholderListing(listingStream, placeholderSize);
+#endif
+			currentInstructionNumber += placeholderSize;
 		}
-		else if (instruction == "BVC")
+		else if (amountOfConstantOpcodes != 0)
 		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_VC, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			currentInstructionNumber += 9;
+			section.insert(section.end(), constantOpcodes, constantOpcodes + amountOfConstantOpcodes);
+#ifdef ASSEMBLER_WRITE_BIT_LISTING
+			for (uint64_t c = 0; c < amountOfConstantOpcodes; c++)
+				WriteBitListing(listingStream, constantOpcodes[c]);
+#endif
+			currentInstructionNumber += amountOfConstantOpcodes;
 		}
-		else if (instruction == "BHI")
+		else
 		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_HI, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			currentInstructionNumber += 9;
+			section.push_back(opcode);
+#ifdef ASSEMBLER_WRITE_BIT_LISTING
+			WriteBitListing(listingStream, opcode);
+#endif
+			currentInstructionNumber++;
 		}
-		else if (instruction == "BLS")
+
+		//12. Flush The Literal Pool Where Execution Can Not Fall Into It
+		previousInstructionWasUnconditional = unconditional;
+		if (unconditional)
 		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_LS, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			currentInstructionNumber += 9;
+#ifdef ASSEMBLER_WRITE_BIT_LISTING
+			WritePlaceholderListing(listingStream, FlushLiteralPool(sourceFile, fileNumber, currentInstructionNumber, pendingLiteralPoolEntries, false));
+#else
+			FlushLiteralPool(sourceFile, fileNumber, currentInstructionNumber, pendingLiteralPoolEntries, false);
+#endif
 		}
-		else if (instruction == "BGE")
+	}
+
+
+	//Anything Left Goes At The End Of The File
+#ifdef ASSEMBLER_WRITE_BIT_LISTING
+	WritePlaceholderListing(listingStream, FlushLiteralPool(sourceFile, fileNumber, currentInstructionNumber, pendingLiteralPoolEntries, !previousInstructionWasUnconditional));
+	if (listingStream.is_open())
+		sourceFile.stats.bytesWritten += (uint64_t)listingStream.tellp();
+	listingStream.close();
+#else
+	FlushLiteralPool(sourceFile, fileNumber, currentInstructionNumber, pendingLiteralPoolEntries, !previousInstructionWasUnconditional);
+#endif
+	sourceFile.stats.lines = currentLineNumber;
+	log << "Successfully PreProcessed " << relativePath << "..." << std::endl;
+	sourceFile.preProcessed = true;
+	return true;
+}
+
+//Appends The Tables Of One PreProcessed File To The Global Maps, Files Must Be Merged In File Number Order
+//"sourceFileNumbers" Gives The File Number Of Every File Being Assembled By Its Path Relative To The Source Folder
+static bool MergeSourceFile(const std::filesystem::path& sourcePath, const std::unordered_map<std::string, uint64_t>& sourceFileNumbers, SourceFileInfo& sourceFile, uint64_t fileNumber)
+{
+	uint64_t labelOffset = s_LabelMap.size();
+	uint64_t byteSequenceOffset = s_ByteSequenceMap.size();
+	uint64_t ptrSequenceOffset = s_PtrSequenceMap.size();
+	uint64_t literalPoolOffset = s_LiteralPoolMap.size();
+
+	for (size_t i = 0; i < sourceFile.symbolDefinitions.size(); i++)
+	{
+		SymbolInfo* symbol = FindSymbol(sourceFile.symbolTable, sourceFile.symbolDefinitions[i].name);
+		uint64_t index = symbol->index;
+		if (symbol->type == ASSEMBLER_SYMBOL_LABEL)
+			index += labelOffset;
+		else if (symbol->type == ASSEMBLER_SYMBOL_BYTE_SEQUENCE)
+			index += byteSequenceOffset;
+		else
+			index += ptrSequenceOffset;
+
+		if (!AddSymbol(s_SymbolTable, symbol->name, symbol->type, index))
 		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_GE, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			currentInstructionNumber += 9;
+			std::cout << "Error on Line " << sourceFile.symbolDefinitions[i].lineNumber << " in " << std::filesystem::relative(sourceFile.path, sourcePath) << std::endl;
+			std::cout << "The Label On This Line Is Already Defined" << std::endl;
+			return false;
 		}
-		else if (instruction == "BLT")
+	}
+
+	s_LabelMap.insert(s_LabelMap.end(), sourceFile.labelMap.begin(), sourceFile.labelMap.end());
+	s_BranchMap.insert(s_BranchMap.end(), std::make_move_iterator(sourceFile.branchMap.begin()), std::make_move_iterator(sourceFile.branchMap.end()));
+	s_ByteSequenceMap.insert(s_ByteSequenceMap.end(), std::make_move_iterator(sourceFile.byteSequenceMap.begin()), std::make_move_iterator(sourceFile.byteSequenceMap.end()));
+	s_PtrSequenceMap.insert(s_PtrSequenceMap.end(), std::make_move_iterator(sourceFile.ptrSequenceMap.begin()), std::make_move_iterator(sourceFile.ptrSequenceMap.end()));
+	for (size_t m = 0; m < sourceFile.movAddressMap.size(); m++)
+	{
+		if (sourceFile.movAddressMap[m].literalPool != UINT64_MAX)
+			sourceFile.movAddressMap[m].literalPool += literalPoolOffset;
+	}
+	s_MovAddressMap.insert(s_MovAddressMap.end(), std::make_move_iterator(sourceFile.movAddressMap.begin()), std::make_move_iterator(sourceFile.movAddressMap.end()));
+	s_LiteralPoolMap.insert(s_LiteralPoolMap.end(), sourceFile.literalPoolMap.begin(), sourceFile.literalPoolMap.end());
+	for (const std::string& joinPath : sourceFile.joinPaths)
+	{
+		auto joinedFile = sourceFileNumbers.find(joinPath);
+		if (joinedFile == sourceFileNumbers.end())
 		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_LT, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			currentInstructionNumber += 9;
+			std::cout << "Error In Assembling..." << std::endl;
+			std::cout << "The ~join Preprocessor Directive In " << std::filesystem::relative(sourceFile.path, sourcePath) << " Joins \"" << joinPath << "\", Which Is Not One Of The Files Being Assembled" << std::endl;
+			return false;
 		}
-		else if (instruction == "BGT")
-		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_GT, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			currentInstructionNumber += 9;
-		}
-		else if (instruction == "BLE")
+		s_JoinMap.emplace_back(fileNumber, joinedFile->second);
+	}
+	s_SectionMap.push_back(std::move(sourceFile.section));
+	s_SourceFilePathMap.push_back(std::filesystem::relative(sourceFile.path, sourcePath));
+
+	sourceFile.symbolTable = SymbolTable();
+	sourceFile.symbolDefinitions.clear();
+	return true;
+}
+
+//A Placeholder That Relaxation Can Shrink, Belonging To Either s_BranchMap[branch] Or s_MovAddressMap[movAddress]
+struct RelaxationInfo
+{
+	uint64_t InstructionNumber;
+	uint64_t placeholderSize;
+	uint64_t relaxedSize;
+	size_t branch;
+	size_t movAddress;
+};
+
+//Where An Instruction Ends Up Once Every Placeholder Has Shrunk To Its Relaxed Size
+//"relaxations" Is Sorted By Position And "removedBefore[k]" Is How Many Instructions The First k Of Them Gave Up
+static uint64_t RelaxInstructionNumber(uint64_t instructionNumber, const std::vector<RelaxationInfo>& relaxations, const std::vector<uint64_t>& removedBefore)
+{
+	size_t low = 0;
+	size_t high = relaxations.size();
+	while (low < high)
+	{
+		size_t middle = (low + high) / 2;
+		if (relaxations[middle].InstructionNumber < instructionNumber)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return instructionNumber - removedBefore[low];
+}
+
+static uint64_t ShortestBranchSize(ASSEMBLER_BRANCH_TYPE type)
+{
+	switch (type)
+	{
+	case ASSEMBLER_BRANCH_AL:
+		return ASSEMBLER_RELAXED_SIZE_BRANCH;
+	case ASSEMBLER_BRANCH_LINK:
+		return ASSEMBLER_RELAXED_SIZE_LINK_BRANCH;
+	case ASSEMBLER_BRANCH_VENEER:
+		return ASSEMBLER_RELAXED_SIZE_VENEER;
+	default:
+		return ASSEMBLER_RELAXED_SIZE_CONDITIONAL_BRANCH;
+	}
+}
+
+static bool IsOffsetInRange(int64_t offset, int64_t minimum, int64_t maximum)
+{
+	return offset >= minimum && offset <= maximum;
+}
+
+//Picks The Shortest Form That Reaches "targetNumber" From "instructionNumber", A Branch Never Shrinks Again Once It Has Grown
+static uint64_t RelaxBranchSize(const BranchInfo& branch, int64_t instructionNumber, int64_t targetNumber, uint64_t currentSize)
+{
+	uint64_t requiredSize = branch.placeholderSize;
+	switch (branch.type)
+	{
+	case ASSEMBLER_BRANCH_AL:
+		if (IsOffsetInRange(targetNumber - (instructionNumber + 2), ASSEMBLER_BRANCH_OFFSET_MIN, ASSEMBLER_BRANCH_OFFSET_MAX))
+			requiredSize = ASSEMBLER_RELAXED_SIZE_BRANCH;
+		break;
+	case ASSEMBLER_BRANCH_LINK:
+		if (IsOffsetInRange(targetNumber - (instructionNumber + 2), ASSEMBLER_LINK_BRANCH_OFFSET_MIN, ASSEMBLER_LINK_BRANCH_OFFSET_MAX))
+			requiredSize = ASSEMBLER_RELAXED_SIZE_LINK_BRANCH;
+		break;
+	case ASSEMBLER_BRANCH_VENEER:
+		if (IsOffsetInRange(targetNumber - (instructionNumber + 3), ASSEMBLER_BRANCH_OFFSET_MIN, ASSEMBLER_BRANCH_OFFSET_MAX))
+			requiredSize = ASSEMBLER_RELAXED_SIZE_VENEER;
+		else if (IsOffsetInRange(targetNumber - (instructionNumber + 3), ASSEMBLER_LINK_BRANCH_OFFSET_MIN, ASSEMBLER_LINK_BRANCH_OFFSET_MAX))
+			requiredSize = ASSEMBLER_RELAXED_SIZE_VENEER_LINK;
+		break;
+	default:
+		if (IsOffsetInRange(targetNumber - (instructionNumber + 2), ASSEMBLER_CONDITIONAL_BRANCH_OFFSET_MIN, ASSEMBLER_CONDITIONAL_BRANCH_OFFSET_MAX))
+			requiredSize = ASSEMBLER_RELAXED_SIZE_CONDITIONAL_BRANCH;
+		else if (IsOffsetInRange(targetNumber - (instructionNumber + 3), ASSEMBLER_BRANCH_OFFSET_MIN, ASSEMBLER_BRANCH_OFFSET_MAX))
+			requiredSize = ASSEMBLER_RELAXED_SIZE_CONDITIONAL_SKIP;
+		break;
+	}
+
+	if (requiredSize < currentSize)
+		return currentSize;
+	return requiredSize;
+}
+
+//B
+static uint16_t EncodeBranch(int64_t instructionNumber, int64_t targetNumber)
+{
+	return (uint16_t)(0b1110000000000000 | ((targetNumber - (instructionNumber + 2)) & 0b0000011111111111));
+}
+
+//Bcc
+static uint16_t EncodeConditionalBranch(ASSEMBLER_BRANCH_TYPE condition, int64_t instructionNumber, int64_t targetNumber)
+{
+	return (uint16_t)(0b1101000000000000 | (condition << 8) | ((targetNumber - (instructionNumber + 2)) & 0b0000000011111111));
+}
+
+//BL, Which Takes Up Two Instructions
+static void EncodeLinkBranch(std::vector<uint16_t>& instructions, uint64_t instructionNumber, int64_t targetNumber)
+{
+	int64_t offset = targetNumber - ((int64_t)instructionNumber + 2);
+	instructions[instructionNumber] = (uint16_t)(0b1111000000000000 | ((offset >> 11) & 0b0000011111111111));
+	instructions[instructionNumber + 1] = (uint16_t)(0b1111100000000000 | (offset & 0b0000011111111111));
+}
+
+//Every BIOS Decompression Stream Starts With Its Type In Bits 4-7 And The Decompressed Size In Bits 8-31
+static void WriteCompressionHeader(std::vector<char>& stream, uint8_t type, uint64_t size)
+{
+	stream.push_back((char)type);
+	stream.push_back((char)(size & 0xFF));
+	stream.push_back((char)((size >> 8) & 0xFF));
+	stream.push_back((char)((size >> 16) & 0xFF));
+}
+
+//SWI 0x11/0x12: Groups Of 8 Blocks, Each Group After A Flag Byte Whose Bits (Highest First) Say Which Blocks Are Matches
+//A Literal Block Is One Byte, A Match Block Is Two: (Length - 3) << 12 | (Distance - 1), Highest Byte First
+static std::vector<char> CompressLZ77(const std::vector<char>& data)
+{
+	std::vector<char> stream;
+	stream.reserve(4 + data.size() + data.size() / 8 + 1);
+	WriteCompressionHeader(stream, 0x10, data.size());
+
+	//Hash Chains Over The Next 3 Bytes, "previous" Only Has To Reach Back As Far As The Window
+	std::vector<int64_t> head((size_t)1 << ASSEMBLER_LZ77_HASH_BITS, -1);
+	std::vector<int64_t> previous(ASSEMBLER_LZ77_WINDOW_SIZE, -1);
+	const uint8_t* bytes = (const uint8_t*)data.data();
+	int64_t size = (int64_t)data.size();
+	auto hashAt = [bytes](int64_t position) { return (uint32_t)(((bytes[position] << 16) | (bytes[position + 1] << 8) | bytes[position + 2]) * 2654435761u) >> (32 - ASSEMBLER_LZ77_HASH_BITS); };
+	auto insert = [&](int64_t position)
+	{
+		if (position + ASSEMBLER_LZ77_MIN_MATCH > size)
+			return;
+		uint32_t hash = hashAt(position);
+		previous[position % ASSEMBLER_LZ77_WINDOW_SIZE] = head[hash];
+		head[hash] = position;
+	};
+
+	size_t flagIndex = 0;
+	uint64_t amountBlocks = 8;
+	int64_t position = 0;
+	while (position < size)
+	{
+		if (amountBlocks == 8)
 		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_LE, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			currentInstructionNumber += 9;
+			flagIndex = stream.size();
+			stream.push_back(0);
+			amountBlocks = 0;
 		}
-		else if (instruction == "BAL")
+
+		int64_t bestLength = 0;
+		int64_t bestDistance = 0;
+		if (position + ASSEMBLER_LZ77_MIN_MATCH <= size)
 		{
-			currentLine.erase(0, 3);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_AL, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-			for (; i < ASSEMBLER_INSTRUCTION_CHAR_SIZE * 2; i++)
-				currentLine.pop_back();
-			currentInstructionNumber += 7;
+			int64_t maxLength = std::min<int64_t>(ASSEMBLER_LZ77_MAX_MATCH, size - position);
+			int64_t candidate = head[hashAt(position)];
+			for (uint64_t chain = 0; candidate >= 0 && position - candidate <= ASSEMBLER_LZ77_WINDOW_SIZE && chain < ASSEMBLER_LZ77_MAX_CHAIN; chain++)
+			{
+				if (position - candidate >= ASSEMBLER_LZ77_MIN_DISTANCE)
+				{
+					int64_t length = 0;
+					while (length < maxLength && bytes[candidate + length] == bytes[position + length])
+						length++;
+					if (length > bestLength)
+					{
+						bestLength = length;
+						bestDistance = position - candidate;
+						if (length == maxLength)
+							break;
+					}
+				}
+				int64_t next = previous[candidate % ASSEMBLER_LZ77_WINDOW_SIZE];
+				if (next >= candidate)
+					break;
+				candidate = next;
+			}
 		}
-		else if (instruction == "BNV")
+
+		if (bestLength >= ASSEMBLER_LZ77_MIN_MATCH)
 		{
-			inputStream.close();
-			outputStream.close();
-			std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-			std::cout << "This Line Contains A BNV Instruction Which Will Give Unpredictable Results" << std::endl;
-			return false;
+			stream[flagIndex] |= (char)(0x80 >> amountBlocks);
+			stream.push_back((char)(((bestLength - 3) << 4) | ((bestDistance - 1) >> 8)));
+			stream.push_back((char)((bestDistance - 1) & 0xFF));
+			for (int64_t k = 0; k < bestLength; k++)
+				insert(position + k);
+			position += bestLength;
 		}
-		else if (instruction == "CALL")
+		else
 		{
-			currentLine.erase(0, 4);
-			ProcessBranchInstruction({ ASSEMBLER_BRANCH_LINK, fileNumber, currentInstructionNumber, currentLine }, currentLine);
-#ifdef ASSEMBLER_CONFIG_DEBUG
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION);
-#endif
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
+			stream.push_back((char)bytes[position]);
+			insert(position);
+			position++;
+		}
+		amountBlocks++;
+	}
+	return stream;
+}
 
-#ifdef ASSEMBLER_CONFIG_DEBUG
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION);
-#endif
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-			currentLine.push_back(ASSEMBLER_OUTPUT_SYMBOL_PLACEHOLDER);
-
-			currentInstructionNumber += 11;
-		}
-		else if (instruction == "RETURN")
-		{
-			currentLine.erase(0, 6);
-			if (!ProcessRETURNInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The RETURN Instruction On This Line Should Not Have Any Parameters" << std::endl;
-				return false;
-			}
+//SWI 0x14/0x15: Each Block Starts With A Flag Byte, Bit 7 Set Means The Next Byte Repeats (Flag & 0x7F) + 3 Times
+//Otherwise (Flag & 0x7F) + 1 Bytes Follow As They Are
+static std::vector<char> CompressRLE(const std::vector<char>& data)
+{
+	std::vector<char> stream;
+	stream.reserve(4 + data.size() + data.size() / ASSEMBLER_RLE_MAX_LITERALS + 1);
+	WriteCompressionHeader(stream, 0x30, data.size());
+
+	size_t literalStart = 0;
+	auto flushLiterals = [&](size_t literalEnd)
+	{
+		while (literalStart < literalEnd)
+		{
+			size_t amountLiterals = std::min<size_t>(literalEnd - literalStart, ASSEMBLER_RLE_MAX_LITERALS);
+			stream.push_back((char)(amountLiterals - 1));
+			stream.insert(stream.end(), data.begin() + literalStart, data.begin() + literalStart + amountLiterals);
+			literalStart += amountLiterals;
 		}
-		else if (instruction == "BIC")
+	};
+
+	size_t position = 0;
+	while (position < data.size())
+	{
+		size_t run = 1;
+		while (position + run < data.size() && run < ASSEMBLER_RLE_MAX_RUN && data[position + run] == data[position])
+			run++;
+		if (run < ASSEMBLER_RLE_MIN_RUN)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessBICInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The BIC Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			position++;
+			continue;
 		}
-		else if (instruction == "CMN")
+		flushLiterals(position);
+		stream.push_back((char)(0x80 | (run - ASSEMBLER_RLE_MIN_RUN)));
+		stream.push_back(data[position]);
+		position += run;
+		literalStart = position;
+	}
+	flushLiterals(data.size());
+	return stream;
+}
+
+//Lays Out The Node Pairs Of A Huffman Tree So That No Node Is More Than ASSEMBLER_HUFFMAN_MAX_NODE_OFFSET Pairs Before Its Children
+//Children Are Placed Depth First, Which Keeps Few Nodes Waiting, Unless That Would Leave A Waiting Node Unable To Reach Its Children In Time
+//Returns False If No Such Layout Was Found, "childPairs[n]" Is The Pair Holding The Children Of Node "n"
+static bool LayOutHuffmanTree(const std::vector<HuffmanNodeInfo>& nodes, uint64_t root, std::vector<std::array<uint64_t, 2>>& pairs, std::vector<int64_t>& childPairs)
+{
+	//Nodes Waiting For Their Children To Be Placed, With The Last Pair Their Children Can Go In
+	std::vector<std::pair<uint64_t, int64_t>> waiting = { { root, ASSEMBLER_HUFFMAN_MAX_NODE_OFFSET } };
+	std::vector<int64_t> deadlines;
+	childPairs.assign(nodes.size(), -1);
+	while (!waiting.empty())
+	{
+		int64_t current = (int64_t)pairs.size();
+
+		//Every Node Left Waiting Must Still Fit If They Were All Placed Soonest Deadline First
+		auto fitsAfter = [&](size_t choice)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessCMNInstruction(currentLine))
+			deadlines.clear();
+			for (size_t k = 0; k < waiting.size(); k++)
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The CMN Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
+				if (k != choice)
+					deadlines.push_back(waiting[k].second);
 			}
-		}
-		else if (instruction == "CMP")
-		{
-			currentLine.erase(0, 3);
-			if (!ProcessCMPInstruction(currentLine))
+			for (uint64_t child : nodes[waiting[choice].first].children)
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The CMP Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
+				if (!nodes[child].leaf)
+					deadlines.push_back(current + ASSEMBLER_HUFFMAN_MAX_NODE_OFFSET + 1);
 			}
-		}
-		else if (instruction == "XOR")
-		{
-			currentLine.erase(0, 3);
-			if (!ProcessXORInstruction(currentLine))
+			std::sort(deadlines.begin(), deadlines.end());
+			for (size_t k = 0; k < deadlines.size(); k++)
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The XOR Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
+				if (deadlines[k] < current + 1 + (int64_t)k)
+					return false;
 			}
+			return true;
+		};
+
+		size_t choice = waiting.size() - 1;
+		if (!fitsAfter(choice))
+			choice = std::min_element(waiting.begin(), waiting.end(), [](const std::pair<uint64_t, int64_t>& a, const std::pair<uint64_t, int64_t>& b) { return a.second < b.second; }) - waiting.begin();
+		if (waiting[choice].second < current)
+			return false;
+
+		uint64_t node = waiting[choice].first;
+		waiting.erase(waiting.begin() + choice);
+		childPairs[node] = current;
+		pairs.push_back({ nodes[node].children[0], nodes[node].children[1] });
+		for (uint64_t child : nodes[node].children)
+		{
+			if (!nodes[child].leaf)
+				waiting.push_back({ child, current + ASSEMBLER_HUFFMAN_MAX_NODE_OFFSET + 1 });
 		}
-		else if (instruction == "LDMIA")
+	}
+	return true;
+}
+
+//SWI 0x13 With 8-Bit Data: After The Header Comes The Tree Table, Then The Code Of Every Byte In 32-Bit Words, Highest Bit First
+//The Tree Table Is Its Size In Pairs Less One, The Root Node, Then The Node Pairs, Padded So The Codes Start Word Aligned
+//Returns An Empty Stream If The Tree Could Not Be Laid Out
+static std::vector<char> CompressHuffman(const std::vector<char>& data)
+{
+	std::vector<HuffmanNodeInfo> nodes;
+	uint64_t frequencies[256] = {};
+	for (char c : data)
+		frequencies[(uint8_t)c]++;
+	for (uint64_t symbol = 0; symbol < 256; symbol++)
+	{
+		if (frequencies[symbol] != 0)
+			nodes.push_back({ frequencies[symbol], { 0, 0 }, (uint8_t)symbol, true });
+	}
+
+	//The Root Needs Two Children, So Unused Symbols Make Up The Numbers
+	for (uint64_t symbol = 0; nodes.size() < 2; symbol++)
+	{
+		if (frequencies[symbol] == 0)
+			nodes.push_back({ 0, { 0, 0 }, (uint8_t)symbol, true });
+	}
+
+	//Ties Go To The Node Made First, So The Same Data Always Makes The Same Tree
+	std::priority_queue<std::pair<uint64_t, uint64_t>, std::vector<std::pair<uint64_t, uint64_t>>, std::greater<std::pair<uint64_t, uint64_t>>> queue;
+	for (uint64_t i = 0; i < nodes.size(); i++)
+		queue.push({ nodes[i].frequency, i });
+	while (queue.size() > 1)
+	{
+		uint64_t child0 = queue.top().second;
+		queue.pop();
+		uint64_t child1 = queue.top().second;
+		queue.pop();
+		nodes.push_back({ nodes[child0].frequency + nodes[child1].frequency, { child0, child1 }, 0, false });
+		queue.push({ nodes.back().frequency, nodes.size() - 1 });
+	}
+	uint64_t root = queue.top().second;
+
+	std::vector<std::array<uint64_t, 2>> pairs;
+	std::vector<int64_t> childPairs;
+	if (!LayOutHuffmanTree(nodes, root, pairs, childPairs))
+		return std::vector<char>();
+
+	std::vector<char> stream;
+	WriteCompressionHeader(stream, 0x28, data.size());
+
+	//An Odd Number Of Pairs Makes The Table A Whole Number Of Words
+	uint64_t amountPairs = pairs.size() | 1;
+	stream.push_back((char)amountPairs);
+	auto nodeByte = [&](uint64_t node, int64_t pair)
+	{
+		if (nodes[node].leaf)
+			return (char)nodes[node].symbol;
+		uint8_t flags = (nodes[nodes[node].children[0]].leaf ? 0x80 : 0) | (nodes[nodes[node].children[1]].leaf ? 0x40 : 0);
+		return (char)(flags | (childPairs[node] - pair - 1));
+	};
+	stream.push_back(nodeByte(root, -1));
+	for (size_t pair = 0; pair < pairs.size(); pair++)
+	{
+		stream.push_back(nodeByte(pairs[pair][0], (int64_t)pair));
+		stream.push_back(nodeByte(pairs[pair][1], (int64_t)pair));
+	}
+	stream.resize(4 + (amountPairs + 1) * 2, 0);
+
+	//Codes Are Found Walking Down From The Root, 0 For The First Child And 1 For The Second
+	std::vector<std::vector<bool>> codes(256);
+	std::vector<std::pair<uint64_t, std::vector<bool>>> walk = { { root, std::vector<bool>() } };
+	while (!walk.empty())
+	{
+		std::pair<uint64_t, std::vector<bool>> step = std::move(walk.back());
+		walk.pop_back();
+		if (nodes[step.first].leaf)
 		{
-			currentLine.erase(0, 5);
-			if (!ProcessLDMIAInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The LDMIA Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			codes[nodes[step.first].symbol] = std::move(step.second);
+			continue;
 		}
-		else if (instruction == "LDR")
+		for (uint64_t k = 0; k < 2; k++)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessLDRInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The LDR Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			walk.push_back({ nodes[step.first].children[k], step.second });
+			walk.back().second.push_back(k == 1);
 		}
-		else if (instruction == "LDRB")
+	}
+
+	uint32_t word = 0;
+	uint64_t amountBits = 0;
+	for (char c : data)
+	{
+		for (bool bit : codes[(uint8_t)c])
 		{
-			currentLine.erase(0, 4);
-			if (!ProcessLDRBInstruction(currentLine))
+			word |= (uint32_t)bit << (31 - amountBits);
+			if (++amountBits == 32)
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The LDRB Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
+				for (uint64_t k = 0; k < 4; k++)
+					stream.push_back((char)((word >> (8 * k)) & 0xFF));
+				word = 0;
+				amountBits = 0;
 			}
 		}
-		else if (instruction == "LDRH")
+	}
+	if (amountBits != 0)
+	{
+		for (uint64_t k = 0; k < 4; k++)
+			stream.push_back((char)((word >> (8 * k)) & 0xFF));
+	}
+	return stream;
+}
+
+static std::vector<char> CompressBytes(const std::vector<char>& data, ASSEMBLER_COMPRESSION_TYPE compression)
+{
+	if (compression == ASSEMBLER_COMPRESSION_LZ77)
+		return CompressLZ77(data);
+	if (compression == ASSEMBLER_COMPRESSION_RLE)
+		return CompressRLE(data);
+	return CompressHuffman(data);
+}
+
+//The Bytes Of Every Sequence Marked With ~compress That Has The Same Bytes And Format, Compressed Once On A Worker Thread
+//Errors Are Only Printed Once Every Worker Has Finished
+struct CompressionJobInfo
+{
+	std::vector<ByteSequenceInfo*> byteSequences;
+	ASSEMBLER_COMPRESSION_TYPE compression;
+	std::vector<char> data;
+	uint64_t dataHash;
+	std::vector<char> stream;
+	bool cached;
+	std::string error;
+};
+
+#ifdef ASSEMBLER_USE_BUILD_CACHE
+//A Cached Stream Is Only Used If It Was Compressed From The Same Bytes, Was Written Out Whole And Has The Header The BIOS Expects
+static bool IsCachedStreamOf(const char* cacheFile, size_t cacheFileSize, const CompressionJobInfo& job)
+{
+	static const uint8_t types[] = { 0x00, 0x10, 0x30, 0x28 };
+	if (cacheFileSize < ASSEMBLER_COMPRESSION_CACHE_HEADER_SIZE + 4)
+		return false;
+	uint64_t header[3];
+	std::memcpy(header, cacheFile, sizeof(header));
+	const char* stream = cacheFile + ASSEMBLER_COMPRESSION_CACHE_HEADER_SIZE;
+	size_t streamSize = cacheFileSize - ASSEMBLER_COMPRESSION_CACHE_HEADER_SIZE;
+	if (header[0] != job.dataHash || header[1] != streamSize || header[2] != HashSymbolName(std::string_view(stream, streamSize)))
+		return false;
+	if ((uint8_t)stream[0] != types[(uint8_t)job.compression])
+		return false;
+	uint64_t size = (uint8_t)stream[1] | ((uint8_t)stream[2] << 8) | ((uint8_t)stream[3] << 16);
+	return size == job.data.size();
+}
+
+static std::string CompressionCacheFile(const CompressionJobInfo& job)
+{
+	uint64_t header[3] = { job.dataHash, job.stream.size(), HashSymbolName(std::string_view(job.stream.data(), job.stream.size())) };
+	std::string cacheFile(reinterpret_cast<const char*>(header), sizeof(header));
+	cacheFile.append(job.stream.data(), job.stream.size());
+	return cacheFile;
+}
+
+//Named After The Format And A Hash Of The Bytes, So The Same Data Is Only Compressed Once, Whichever File It Comes From
+static std::filesystem::path CompressionCacheFilePath(const std::filesystem::path& sourcePath, const CompressionJobInfo& job)
+{
+	static const char* extensions[] = { "", ".lz77", ".rle", ".huffman" };
+	std::ostringstream cacheFileName;
+	cacheFileName << std::hex << job.dataHash << std::dec << "-" << job.data.size() << extensions[(uint8_t)job.compression];
+	return sourcePath / ASSEMBLER_CACHE_DIRECTORY / cacheFileName.str();
+}
+#endif
+
+//Keeps Claiming The Next Unclaimed Job Until There Are None Left, A Finished Job Has Its Stream In "stream"
+static void CompressionWorker([[maybe_unused]] const std::filesystem::path& sourcePath, std::vector<CompressionJobInfo>& jobs, std::atomic<size_t>& nextJob)
+{
+	while (true)
+	{
+		size_t jobNumber = nextJob++;
+		if (jobNumber >= jobs.size())
+			return;
+		CompressionJobInfo& job = jobs[jobNumber];
+
+#ifdef ASSEMBLER_USE_BUILD_CACHE
+		std::filesystem::path cacheFilePath = CompressionCacheFilePath(sourcePath, job);
+		SourceTextInfo cacheText;
+		if (LoadSourceText(cacheFilePath, cacheText) && IsCachedStreamOf(cacheText.text, cacheText.size, job))
 		{
-			currentLine.erase(0, 4);
-			if (!ProcessLDRHInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The LDRH Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			job.stream.assign(cacheText.text + ASSEMBLER_COMPRESSION_CACHE_HEADER_SIZE, cacheText.text + cacheText.size);
+			job.cached = true;
+			continue;
 		}
-		else if (instruction == "LDRSB")
+#endif
+
+		job.stream = CompressBytes(job.data, job.compression);
+		if (job.stream.empty())
 		{
-			currentLine.erase(0, 5);
-			if (!ProcessLDRSBInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The LDRSB Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			job.error = "A Byte Sequence Marked With ~compress \"huffman\" Needs A Huffman Tree The BIOS Can Not Read, Use \"lz77\" Or \"rle\" For It Instead";
+			continue;
 		}
-		else if (instruction == "LDRSH")
+#ifdef ASSEMBLER_USE_BUILD_CACHE
+		WriteFileAtomically(cacheFilePath, CompressionCacheFile(job));
+#endif
+	}
+}
+
+//Replaces The Bytes Of Every Sequence Marked With ~compress With Its Compressed Stream, On "s_BuildOptions.jobCount" Threads
+static bool CompressByteSequences(const std::filesystem::path& sourcePath)
+{
+	//Sequences Are Grouped By The Hash Of Their Bytes, So Each Different Piece Of Data Is Only Compressed Once
+	std::vector<CompressionJobInfo> jobs;
+	std::unordered_map<uint64_t, std::vector<size_t>> jobsByHash;
+	for (ByteSequenceInfo& byteSequence : s_ByteSequenceMap)
+	{
+		if (byteSequence.compression == ASSEMBLER_COMPRESSION_NONE)
+			continue;
+		byteSequence.alignment = std::max<uint64_t>(byteSequence.alignment, ASSEMBLER_COMPRESSION_ALIGNMENT);
+
+		//Included Files Have To Be Read In To Be Compressed
+		std::vector<char> data;
+		if (byteSequence.includedPath.empty())
 		{
-			currentLine.erase(0, 5);
-			if (!ProcessLDRSHInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The LDRSH Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			data = std::move(byteSequence.bytes);
 		}
-		else if (instruction == "LSL")
+		else
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessLSLInstruction(currentLine))
+			data.resize(byteSequence.includedSize);
+			std::ifstream includedStream(sourcePath / byteSequence.includedPath, std::ios::in | std::ios::binary);
+			includedStream.seekg(byteSequence.includedOffset);
+			includedStream.read(data.data(), data.size());
+			if (!includedStream)
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The LSL Instruction On This Line Has Invalid Parameters" << std::endl;
+				std::cout << "Error In Assembling..." << std::endl;
+				std::cout << "Could Not Read " << data.size() << " Bytes From " << byteSequence.includedPath << ", Which Was Included By ~incbin" << std::endl;
 				return false;
 			}
+			byteSequence.includedPath.clear();
 		}
-		else if (instruction == "LSR")
+		if (data.size() > ASSEMBLER_COMPRESSION_MAX_SIZE)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessLSRInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The LSR Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			std::cout << "Error In Assembling..." << std::endl;
+			std::cout << "A Byte Sequence Marked With ~compress Is " << data.size() << " Bytes Long, The BIOS Can Only Decompress Up To " << ASSEMBLER_COMPRESSION_MAX_SIZE << " Bytes" << std::endl;
+			return false;
 		}
-		else if (instruction == "MOV")
+
+		uint64_t dataHash = HashSymbolName(std::string_view(data.data(), data.size()));
+		std::vector<size_t>& sameHashJobs = jobsByHash[dataHash];
+		bool joined = false;
+		for (size_t jobNumber : sameHashJobs)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessMOVInstruction(currentLine))
+			CompressionJobInfo& job = jobs[jobNumber];
+			if (job.compression == byteSequence.compression && job.data == data)
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The MOV Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
+				job.byteSequences.push_back(&byteSequence);
+				joined = true;
+				break;
 			}
 		}
-		else if (instruction == "MOVA")
+		if (joined)
+			continue;
+		sameHashJobs.push_back(jobs.size());
+		jobs.push_back({ { &byteSequence }, byteSequence.compression, std::move(data), dataHash, std::vector<char>(), false, std::string() });
+	}
+
+	std::atomic<size_t> nextJob = 0;
+	std::vector<std::thread> workers;
+	for (uint64_t i = 1; i < s_BuildOptions.jobCount && i < jobs.size(); i++)
+		workers.emplace_back(CompressionWorker, std::cref(sourcePath), std::ref(jobs), std::ref(nextJob));
+	CompressionWorker(sourcePath, jobs, nextJob);
+	for (std::thread& worker : workers)
+		worker.join();
+
+	for (const CompressionJobInfo& job : jobs)
+	{
+		if (!job.error.empty())
 		{
-			currentLine.erase(0, 4);
-			if (!ProcessMOVAInstruction(currentLine, fileNumber, currentInstructionNumber))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The MOVA Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
-			currentInstructionNumber += 6;
+			std::cout << "Error In Assembling..." << std::endl;
+			std::cout << job.error << std::endl;
+			return false;
 		}
-		else if (instruction == "MUL")
+		for (ByteSequenceInfo* byteSequence : job.byteSequences)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessMULInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The MUL Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			byteSequence->bytes = job.stream;
+			s_BuildStats.compressedSequences++;
+			s_BuildStats.compressionCacheHits += job.cached;
+			s_BuildStats.uncompressedBytes += job.data.size();
+			s_BuildStats.compressedBytes += job.stream.size();
 		}
-		else if (instruction == "MVN")
+	}
+	return true;
+}
+
+static uint64_t AlignmentPadding(uint64_t address, uint64_t alignment)
+{
+	return (alignment - address % alignment) % alignment;
+}
+
+//Places Every Piece Of Data From The Largest Alignment Down, Starting At "address", And Returns Where The Data Ends
+//Before Padding Up To The Next Piece, The Gap Is Filled With The Largest Less Aligned Pieces That Fit In It
+static uint64_t LayOutData(std::vector<DataLayoutInfo>& data, uint64_t address, uint64_t& paddingBytes)
+{
+	std::vector<uint64_t> dataOrder(data.size());
+	for (size_t i = 0; i < data.size(); i++)
+		dataOrder[i] = i;
+	std::stable_sort(dataOrder.begin(), dataOrder.end(), [&data](uint64_t a, uint64_t b) { return data[a].alignment > data[b].alignment; });
+
+	//Pieces Small Enough To Fill A Gap, By Alignment Class And Size, With The Earliest Piece At The Back
+	std::vector<std::vector<uint64_t>> gapFillers(ASSEMBLER_DATA_ALIGNMENT_CLASSES * ASSEMBLER_MAX_DATA_ALIGNMENT);
+	for (size_t i = data.size(); i-- > 0;)
+	{
+		if (data[i].size == 0 || data[i].size >= ASSEMBLER_MAX_DATA_ALIGNMENT)
+			continue;
+		uint64_t alignmentClass = std::countr_zero(data[i].alignment);
+		gapFillers[alignmentClass * ASSEMBLER_MAX_DATA_ALIGNMENT + data[i].size].push_back(i);
+	}
+
+	for (uint64_t next : dataOrder)
+	{
+		if (data[next].placed)
+			continue;
+
+		uint64_t gap = AlignmentPadding(address, data[next].alignment);
+		while (gap > 0)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessMVNInstruction(currentLine))
+			uint64_t bestFiller = UINT64_MAX;
+			uint64_t bestFillerPadding = 0;
+			for (uint64_t alignmentClass = 0; ((uint64_t)1 << alignmentClass) < data[next].alignment; alignmentClass++)
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The MVN Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
+				uint64_t fillerPadding = AlignmentPadding(address, (uint64_t)1 << alignmentClass);
+				uint64_t bestSize = bestFiller == UINT64_MAX ? 0 : data[bestFiller].size;
+				for (uint64_t size = gap - std::min(gap, fillerPadding); size > bestSize; size--)
+				{
+					std::vector<uint64_t>& fillers = gapFillers[alignmentClass * ASSEMBLER_MAX_DATA_ALIGNMENT + size];
+					while (!fillers.empty() && data[fillers.back()].placed)
+						fillers.pop_back();
+					if (fillers.empty())
+						continue;
+					bestFiller = fillers.back();
+					bestFillerPadding = fillerPadding;
+					break;
+				}
 			}
+			if (bestFiller == UINT64_MAX)
+				break;
+
+			paddingBytes += bestFillerPadding;
+			data[bestFiller].address = address + bestFillerPadding;
+			data[bestFiller].placed = true;
+			address += bestFillerPadding + data[bestFiller].size;
+			gap -= bestFillerPadding + data[bestFiller].size;
 		}
-		else if (instruction == "NEG")
+
+		paddingBytes += gap;
+		data[next].address = address + gap;
+		data[next].placed = true;
+		address += gap + data[next].size;
+	}
+	return address;
+}
+
+//Points Every Byte Sequence At The Sequence Its Bytes Will Actually Be Written In, "hosts[i] == i" For Every Sequence That Is Written
+//Exact Duplicates Fold Into The First Copy, Which Takes The Strictest Alignment Of Them All
+//A Sequence Whose Bytes End Another Sequence Is Tail Merged Into It, But Only When Its Offset Into That Sequence Keeps Its Alignment
+static void MergeByteSequences(std::vector<uint64_t>& hosts, std::vector<uint64_t>& hostOffsets)
+{
+	hosts.resize(s_ByteSequenceMap.size());
+	hostOffsets.assign(s_ByteSequenceMap.size(), 0);
+	for (size_t i = 0; i < s_ByteSequenceMap.size(); i++)
+		hosts[i] = i;
+
+	std::unordered_map<std::string_view, uint64_t> firstCopies;
+	firstCopies.reserve(s_ByteSequenceMap.size());
+	std::vector<uint64_t> tailCandidates;
+	for (size_t i = 0; i < s_ByteSequenceMap.size(); i++)
+	{
+		ByteSequenceInfo& byteSequence = s_ByteSequenceMap[i];
+		if (byteSequence.bytes.empty())
+			continue;
+
+		std::pair<std::unordered_map<std::string_view, uint64_t>::iterator, bool> firstCopy = firstCopies.try_emplace(std::string_view(byteSequence.bytes.data(), byteSequence.bytes.size()), i);
+		if (firstCopy.second)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessNEGInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The NEG Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			tailCandidates.push_back(i);
+			continue;
 		}
-		else if (instruction == "ORR")
+		hosts[i] = firstCopy.first->second;
+		s_ByteSequenceMap[hosts[i]].alignment = std::max(s_ByteSequenceMap[hosts[i]].alignment, byteSequence.alignment);
+	}
+
+	//Sorted By Their Bytes Read Backwards, Any Sequence That Ends Another Sits Right Before One It Ends
+	std::sort(tailCandidates.begin(), tailCandidates.end(), [](uint64_t a, uint64_t b)
+	{
+		const std::vector<char>& bytesA = s_ByteSequenceMap[a].bytes;
+		const std::vector<char>& bytesB = s_ByteSequenceMap[b].bytes;
+		return std::lexicographical_compare(bytesA.rbegin(), bytesA.rend(), bytesB.rbegin(), bytesB.rend());
+	});
+	for (size_t k = tailCandidates.size(); k-- > 1;)
+	{
+		uint64_t tail = tailCandidates[k - 1];
+		uint64_t next = tailCandidates[k];
+		const std::vector<char>& tailBytes = s_ByteSequenceMap[tail].bytes;
+		const std::vector<char>& nextBytes = s_ByteSequenceMap[next].bytes;
+		if (!std::equal(tailBytes.rbegin(), tailBytes.rend(), nextBytes.rbegin()))
+			continue;
+
+		//The Next Sequence Was Resolved First, So Its Host Is Final
+		uint64_t host = hosts[next];
+		uint64_t hostOffset = hostOffsets[next] + nextBytes.size() - tailBytes.size();
+		uint64_t alignment = s_ByteSequenceMap[tail].alignment;
+		if (alignment > s_ByteSequenceMap[host].alignment || hostOffset % alignment != 0)
+			continue;
+		hosts[tail] = host;
+		hostOffsets[tail] = hostOffset;
+	}
+
+	//Duplicates Of A Sequence That Was Then Tail Merged Follow It Into Its Host
+	for (size_t i = 0; i < s_ByteSequenceMap.size(); i++)
+	{
+		if (hosts[i] != i && hosts[hosts[i]] != hosts[i])
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessORRInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The ORR Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			hostOffsets[i] += hostOffsets[hosts[i]];
+			hosts[i] = hosts[hosts[i]];
 		}
-		else if (instruction == "ROR")
+		if (hosts[i] != i)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessRORInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The ROR Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			s_BuildStats.mergedByteSequences++;
+			s_BuildStats.mergedBytes += s_ByteSequenceMap[i].bytes.size();
 		}
-		else if (instruction == "SBC")
+	}
+}
+
+//--gc Splits Every Section Into Labelled Regions, Each Running From One Label To The Next (The Code Before A File's First Label Is One Too)
+//Regions, Byte Sequences And Pointer Sequences Are Kept Only If ENTRY Reaches Them Through Branches, CALLs, MOVAs, Pointer Sequences
+//Or By Falling Through From The Region Before, The Rest Are Taken Out Of The Global Maps Before Anything Is Laid Out
+static void CollectGarbage(const std::vector<uint64_t>& fileOrder, const LabelInfo& entryPoint)
+{
+	uint64_t amountOfFiles = s_SectionMap.size();
+
+	//Labels At The Same Place Share A Region, "regionStart[firstRegion[f]]" Up To "regionStart[firstRegion[f + 1]]" Are The Regions Of File f
+	std::vector<std::vector<uint64_t>> labelsOfFile(amountOfFiles);
+	for (const LabelInfo& label : s_LabelMap)
+		labelsOfFile[label.fileNumber].push_back(label.instructionNumber);
+	std::vector<uint64_t> firstRegion(amountOfFiles + 1, 0);
+	std::vector<uint64_t> regionStart;
+	std::vector<uint64_t> regionEnd;
+	for (size_t f = 0; f < amountOfFiles; f++)
+	{
+		firstRegion[f] = regionStart.size();
+		regionStart.push_back(0);
+		std::sort(labelsOfFile[f].begin(), labelsOfFile[f].end());
+		for (uint64_t labelStart : labelsOfFile[f])
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessSBCInstruction(currentLine))
+			if (labelStart != regionStart.back())
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The SBC Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
+				regionEnd.push_back(labelStart);
+				regionStart.push_back(labelStart);
 			}
 		}
-		else if (instruction == "STMIA")
+		regionEnd.push_back(s_SectionMap[f].size());
+	}
+	firstRegion[amountOfFiles] = regionStart.size();
+	uint64_t amountOfRegions = regionStart.size();
+	auto regionOf = [&](uint64_t fileNumber, uint64_t instructionNumber)
+	{
+		return (uint64_t)(std::upper_bound(regionStart.begin() + firstRegion[fileNumber], regionStart.begin() + firstRegion[fileNumber + 1], instructionNumber) - regionStart.begin()) - 1;
+	};
+
+	//A Region Falls Into The Next Unless It Ends With B, RETURN (POP {..., PC}) Or A Literal Pool That Is Not Branched Over
+	std::vector<bool> fallsThrough(amountOfRegions, true);
+	for (size_t f = 0; f < amountOfFiles; f++)
+	{
+		for (uint64_t r = firstRegion[f]; r < firstRegion[f + 1]; r++)
 		{
-			currentLine.erase(0, 5);
-			if (!ProcessSTMIAInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The STMIA Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			if (regionEnd[r] > regionStart[r] && (s_SectionMap[f][regionEnd[r] - 1] & 0xFF00) == 0xBD00)
+				fallsThrough[r] = false;
 		}
-		else if (instruction == "STR")
+	}
+	for (const BranchInfo& branch : s_BranchMap)
+	{
+		uint64_t region = regionOf(branch.fileNumber, branch.InstructionNumber);
+		if (branch.InstructionNumber + branch.placeholderSize == regionEnd[region])
+			fallsThrough[region] = (branch.type != ASSEMBLER_BRANCH_AL);
+	}
+	for (const LiteralPoolInfo& literalPool : s_LiteralPoolMap)
+	{
+		uint64_t region = regionOf(literalPool.fileNumber, literalPool.InstructionNumber);
+		if (literalPool.InstructionNumber + LiteralPoolSize(literalPool) == regionEnd[region])
+			fallsThrough[region] = literalPool.skipped;
+	}
+
+	//The Nodes Of The Reference Graph Are The Regions, Then The Byte Sequences, Then The Pointer Sequences
+	//Names That Are Not Symbols Are Memory Region Addresses, Or Undefined Labels That Are Reported Later On
+	uint64_t firstByteSequence = amountOfRegions;
+	uint64_t firstPtrSequence = firstByteSequence + s_ByteSequenceMap.size();
+	auto symbolNode = [&](const std::string& name)
+	{
+		SymbolInfo* symbol = FindSymbol(s_SymbolTable, name);
+		if (symbol == nullptr)
+			return UINT64_MAX;
+		if (symbol->type == ASSEMBLER_SYMBOL_BYTE_SEQUENCE)
+			return firstByteSequence + symbol->index;
+		if (symbol->type == ASSEMBLER_SYMBOL_PTR_SEQUENCE)
+			return firstPtrSequence + symbol->index;
+		return regionOf(s_LabelMap[symbol->index].fileNumber, s_LabelMap[symbol->index].instructionNumber);
+	};
+
+	std::vector<std::pair<uint64_t, uint64_t>> references;
+	uint64_t previousRegion = UINT64_MAX;
+	for (uint64_t file : fileOrder)
+	{
+		for (uint64_t r = firstRegion[file]; r < firstRegion[file + 1]; r++)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessSTRInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The STR Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			if (previousRegion != UINT64_MAX && fallsThrough[previousRegion])
+				references.emplace_back(previousRegion, r);
+			previousRegion = r;
 		}
-		else if (instruction == "STRB")
+	}
+	for (const BranchInfo& branch : s_BranchMap)
+		references.emplace_back(regionOf(branch.fileNumber, branch.InstructionNumber), symbolNode(branch.label));
+	for (const MovAddressInfo& movAddress : s_MovAddressMap)
+	{
+		uint64_t region = regionOf(movAddress.fileNumber, movAddress.InstructionNumber);
+		references.emplace_back(region, symbolNode(movAddress.label));
+		if (movAddress.literalPool != UINT64_MAX)
+			references.emplace_back(region, regionOf(s_LiteralPoolMap[movAddress.literalPool].fileNumber, s_LiteralPoolMap[movAddress.literalPool].InstructionNumber));
+	}
+	for (size_t p = 0; p < s_PtrSequenceMap.size(); p++)
+	{
+		for (const std::string& pointer : s_PtrSequenceMap[p].pointers)
+			references.emplace_back(firstPtrSequence + p, symbolNode(pointer));
+	}
+	std::sort(references.begin(), references.end());
+
+	std::vector<bool> reachable(firstPtrSequence + s_PtrSequenceMap.size(), false);
+	std::vector<uint64_t> pendingNodes = { regionOf(entryPoint.fileNumber, entryPoint.instructionNumber) };
+	reachable[pendingNodes.back()] = true;
+	while (!pendingNodes.empty())
+	{
+		uint64_t node = pendingNodes.back();
+		pendingNodes.pop_back();
+		for (auto reference = std::lower_bound(references.begin(), references.end(), std::make_pair(node, (uint64_t)0)); reference != references.end() && reference->first == node; reference++)
 		{
-			currentLine.erase(0, 4);
-			if (!ProcessSTRBInstruction(currentLine))
+			if (reference->second != UINT64_MAX && !reachable[reference->second])
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The STRB Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
+				reachable[reference->second] = true;
+				pendingNodes.push_back(reference->second);
 			}
 		}
-		else if (instruction == "STRH")
+	}
+
+	//Placeholders Would Have Been Relaxed, So Removed Code Is Reported With Each Branch And MOVA At Its Shortest Size
+	std::vector<uint64_t> relaxableSize(amountOfRegions, 0);
+	for (const BranchInfo& branch : s_BranchMap)
+		relaxableSize[regionOf(branch.fileNumber, branch.InstructionNumber)] += branch.placeholderSize - ShortestBranchSize(branch.type);
+	for (const MovAddressInfo& movAddress : s_MovAddressMap)
+	{
+		if (movAddress.literalPool != UINT64_MAX)
+			relaxableSize[regionOf(movAddress.fileNumber, movAddress.InstructionNumber)] += movAddress.placeholderSize - ASSEMBLER_RELAXED_SIZE_MOV_ADDRESS;
+	}
+
+	//Assemble Adds A Veneer For Each CALLed Label, So One Is Saved For Every Label That Is Only CALLed From Removed Code
+	std::vector<uint8_t> callersOfLabel(s_LabelMap.size(), 0);
+	for (const BranchInfo& branch : s_BranchMap)
+	{
+		SymbolInfo* symbol = FindSymbol(s_SymbolTable, branch.label);
+		if (branch.type == ASSEMBLER_BRANCH_LINK && symbol != nullptr && symbol->type == ASSEMBLER_SYMBOL_LABEL)
+			callersOfLabel[symbol->index] |= (reachable[regionOf(branch.fileNumber, branch.InstructionNumber)] ? 2 : 1);
+	}
+	for (uint8_t callers : callersOfLabel)
+	{
+		if (callers == 1)
+			s_BuildStats.removedCodeBytes += ASSEMBLER_RELAXED_SIZE_VENEER * ASSEMBLER_INSTRUCTION_BYTE_SIZE;
+	}
+
+	//Every Region Moves Back By The Size Of The Unreachable Regions Before It In Its File
+	std::vector<uint64_t> removedBefore(amountOfRegions, 0);
+	for (size_t f = 0; f < amountOfFiles; f++)
+	{
+		std::vector<uint16_t>& section = s_SectionMap[f];
+		uint64_t removed = 0;
+		for (uint64_t r = firstRegion[f]; r < firstRegion[f + 1]; r++)
 		{
-			currentLine.erase(0, 4);
-			if (!ProcessSTRHInstruction(currentLine))
+			removedBefore[r] = removed;
+			if (reachable[r])
+				std::copy(section.begin() + regionStart[r], section.begin() + regionEnd[r], section.begin() + (regionStart[r] - removed));
+			else
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The STRH Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
+				removed += regionEnd[r] - regionStart[r];
+				s_BuildStats.removedCodeBytes += (regionEnd[r] - regionStart[r] - relaxableSize[r]) * ASSEMBLER_INSTRUCTION_BYTE_SIZE;
 			}
 		}
-		else if (instruction == "SUB")
+		section.resize(section.size() - removed);
+	}
+
+	for (LabelInfo& label : s_LabelMap)
+	{
+		uint64_t region = regionOf(label.fileNumber, label.instructionNumber);
+		label.instructionNumber -= removedBefore[region];
+		s_BuildStats.removedLabels += !reachable[region];
+	}
+
+	std::vector<uint64_t> movedLiteralPools(s_LiteralPoolMap.size(), UINT64_MAX);
+	size_t kept = 0;
+	for (size_t i = 0; i < s_LiteralPoolMap.size(); i++)
+	{
+		uint64_t region = regionOf(s_LiteralPoolMap[i].fileNumber, s_LiteralPoolMap[i].InstructionNumber);
+		if (!reachable[region])
+			continue;
+		s_LiteralPoolMap[i].InstructionNumber -= removedBefore[region];
+		movedLiteralPools[i] = kept;
+		s_LiteralPoolMap[kept++] = s_LiteralPoolMap[i];
+	}
+	s_LiteralPoolMap.resize(kept);
+
+	kept = 0;
+	for (size_t i = 0; i < s_BranchMap.size(); i++)
+	{
+		uint64_t region = regionOf(s_BranchMap[i].fileNumber, s_BranchMap[i].InstructionNumber);
+		if (!reachable[region])
+			continue;
+		s_BranchMap[i].InstructionNumber -= removedBefore[region];
+		if (kept != i)
+			s_BranchMap[kept] = std::move(s_BranchMap[i]);
+		kept++;
+	}
+	s_BranchMap.resize(kept);
+
+	kept = 0;
+	for (size_t i = 0; i < s_MovAddressMap.size(); i++)
+	{
+		uint64_t region = regionOf(s_MovAddressMap[i].fileNumber, s_MovAddressMap[i].InstructionNumber);
+		if (!reachable[region])
+			continue;
+		s_MovAddressMap[i].InstructionNumber -= removedBefore[region];
+		if (s_MovAddressMap[i].literalPool != UINT64_MAX)
+			s_MovAddressMap[i].literalPool = movedLiteralPools[s_MovAddressMap[i].literalPool];
+		if (kept != i)
+			s_MovAddressMap[kept] = std::move(s_MovAddressMap[i]);
+		kept++;
+	}
+	s_MovAddressMap.resize(kept);
+
+	//Symbols Of Removed Sequences Are Left Pointing Nowhere, Nothing That Was Kept Refers To Them
+	std::vector<uint64_t> movedByteSequences(s_ByteSequenceMap.size(), UINT64_MAX);
+	kept = 0;
+	for (size_t i = 0; i < s_ByteSequenceMap.size(); i++)
+	{
+		if (!reachable[firstByteSequence + i])
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessSUBInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The SUB Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			s_BuildStats.removedByteSequences++;
+			s_BuildStats.removedDataBytes += ByteSequenceSize(s_ByteSequenceMap[i]);
+			continue;
 		}
-		else if (instruction == "SUBSP")
+		movedByteSequences[i] = kept;
+		if (kept != i)
+			s_ByteSequenceMap[kept] = std::move(s_ByteSequenceMap[i]);
+		kept++;
+	}
+	s_ByteSequenceMap.resize(kept);
+
+	std::vector<uint64_t> movedPtrSequences(s_PtrSequenceMap.size(), UINT64_MAX);
+	kept = 0;
+	for (size_t i = 0; i < s_PtrSequenceMap.size(); i++)
+	{
+		if (!reachable[firstPtrSequence + i])
 		{
-			currentLine.erase(0, 5);
-			if (!ProcessSUBSPInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The SUBSP Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			s_BuildStats.removedPtrSequences++;
+			s_BuildStats.removedDataBytes += 4 * s_PtrSequenceMap[i].pointers.size();
+			continue;
 		}
-		else if (instruction == "SWI")
+		movedPtrSequences[i] = kept;
+		if (kept != i)
+			s_PtrSequenceMap[kept] = std::move(s_PtrSequenceMap[i]);
+		kept++;
+	}
+	s_PtrSequenceMap.resize(kept);
+
+	for (SymbolInfo& symbol : s_SymbolTable.slots)
+	{
+		if (symbol.name.empty())
+			continue;
+		if (symbol.type == ASSEMBLER_SYMBOL_BYTE_SEQUENCE)
+			symbol.index = movedByteSequences[symbol.index];
+		else if (symbol.type == ASSEMBLER_SYMBOL_PTR_SEQUENCE)
+			symbol.index = movedPtrSequences[symbol.index];
+	}
+}
+
+//Which Condition Flags An Instruction Always Sets And Which It Reads, A Shift By A Register Only Sets N And Z Since Shifting By 0 Leaves C Alone
+//Returns False For Anything That Can Leave The Straight Line Of Code: SWI, RETURN, BX, Branches And Writes To PC
+static bool FindFlagUse(uint16_t opcode, uint8_t& writtenFlags, uint8_t& readFlags)
+{
+	writtenFlags = 0;
+	readFlags = 0;
+
+	//LSL, LSR And ASR By An Immediate, LSL #0 Leaves C Alone
+	if (opcode < 0x1800)
+	{
+		writtenFlags = ASSEMBLER_FLAGS_NZ;
+		if ((opcode & 0x1FC0) != 0)
+			writtenFlags |= ASSEMBLER_FLAG_C;
+		return true;
+	}
+
+	//ADD And SUB With Three Registers Or A 3-Bit Immediate
+	if (opcode < 0x2000)
+	{
+		writtenFlags = ASSEMBLER_FLAGS_NZCV;
+		return true;
+	}
+
+	//MOV, CMP, ADD And SUB With An 8-Bit Immediate
+	if (opcode < 0x4000)
+	{
+		writtenFlags = (opcode < 0x2800) ? ASSEMBLER_FLAGS_NZ : ASSEMBLER_FLAGS_NZCV;
+		return true;
+	}
+
+	//The ALU Operations, Only ADC And SBC Read A Flag
+	if (opcode < 0x4400)
+	{
+		uint16_t operation = (opcode >> 6) & 0xF;
+		writtenFlags = ASSEMBLER_FLAGS_NZ;
+		if (operation == 0x5 || operation == 0x6)
+			readFlags = ASSEMBLER_FLAG_C;
+		if (operation == 0x5 || operation == 0x6 || operation == 0x9 || operation == 0xA || operation == 0xB)
+			writtenFlags = ASSEMBLER_FLAGS_NZCV;
+		return true;
+	}
+
+	//ADD, CMP And MOV With High Registers, And BX
+	if (opcode < 0x4800)
+	{
+		uint16_t operation = (opcode >> 8) & 0x3;
+		if (operation == 0x1)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessSWIInstruction(currentLine))
-			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The SWI Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
-			}
+			writtenFlags = ASSEMBLER_FLAGS_NZCV;
+			return true;
 		}
-		else if (instruction == "TST")
+		return operation != 0x3 && (((opcode >> 4) & 0x8) | (opcode & 0x7)) != 15;
+	}
+
+	//Loads, Stores And ADD Rd, PC/SP
+	if (opcode < 0xB000)
+		return true;
+
+	//ADD SP, PUSH And POP Without PC
+	if ((opcode & 0xFF00) == 0xB000 || (opcode & 0xFE00) == 0xB400 || (opcode & 0xFF00) == 0xBC00)
+		return true;
+
+	//LDMIA And STMIA
+	return opcode >= 0xC000 && opcode < 0xD000;
+}
+
+//True If Every Flag In "flags" Is Set Again By The Instructions From "start" On Before Anything Reads It
+//A Run Ends At A Label, A Placeholder Or The End Of Its Section, Where The Flags Might Still Be Read, So Running Out Of Instructions Means They Are Not Dead
+static bool AreFlagsDead(const std::vector<uint16_t>& run, size_t start, uint8_t flags)
+{
+	for (size_t i = start; i < run.size(); i++)
+	{
+		uint8_t writtenFlags;
+		uint8_t readFlags;
+		if (!FindFlagUse(run[i], writtenFlags, readFlags) || (readFlags & flags) != 0)
+			return false;
+		flags &= ~writtenFlags;
+		if (flags == 0)
+			return true;
+	}
+	return false;
+}
+
+static std::string RegisterName(uint16_t registerNumber)
+{
+	return std::string("R") + "0123456789ABCDEF"[registerNumber];
+}
+
+//Writes Out An Instruction The Peephole Pass Touches In The Syntax Of The Source, Shifts Are Given As Encoded
+static std::string DescribeInstruction(uint16_t opcode)
+{
+	std::string Rd = RegisterName(opcode & 0x7);
+	std::string Rs = RegisterName((opcode >> 3) & 0x7);
+
+	if ((opcode & 0xFFC0) == 0x1C00)
+		return "MOV " + Rd + ", " + Rs;
+	if ((opcode & 0xE000) == 0x2000)
+	{
+		static constexpr const char* immediateMnemonics[4] = { "MOV ", "CMP ", "ADD ", "SUB " };
+		return immediateMnemonics[(opcode >> 11) & 0x3] + RegisterName((opcode >> 8) & 0x7) + ", #" + std::to_string(opcode & 0xFF);
+	}
+	if ((opcode & 0xFFC0) == 0x4200)
+		return "TST " + Rd + ", " + Rs;
+	if ((opcode & 0xFFC0) == 0x4280)
+		return "CMP " + Rd + ", " + Rs;
+	if ((opcode & 0xFFC0) == 0x42C0)
+		return "CMN " + Rd + ", " + Rs;
+
+	//MOV And CMP Between High Registers
+	return ((opcode & 0x0200) ? "MOV " : "CMP ") + RegisterName(((opcode >> 4) & 0x8) | (opcode & 0x7)) + ", " + RegisterName((opcode >> 3) & 0xF);
+}
+
+//Rewrites A Run Of Instructions That No Label Points Into And No Placeholder Interrupts, Each Rewrite Goes Into "rewrites" With The Index It Took Place At
+//"removed[i]" Is Set For Every Instruction Taken Out, A Removed Instruction Lets The One Before It Meet The One After It, So Rewrites Can Follow Each Other
+//A Load Right After A Store To The Same Address Is Not Turned Into A Register Move: LDRB/LDRH Give Back The Stored Value Zero-Extended, Not The Whole Register,
+//A Misaligned LDR Rotates The Word And An IO Register Can Read Back Differently Than It Was Written, Which The Address In A Register Cannot Tell Apart
+static void OptimizeRun(std::vector<uint16_t>& run, std::vector<bool>& removed, std::vector<std::pair<size_t, std::string>>& rewrites)
+{
+	std::vector<size_t> kept;
+	for (size_t i = 0; i < run.size(); i++)
+	{
+		bool rewritten = true;
+		while (rewritten)
 		{
-			currentLine.erase(0, 3);
-			if (!ProcessTSTInstruction(currentLine))
+			rewritten = false;
+			uint16_t opcode = run[i];
+			uint16_t Rd = opcode & 0x7;
+
+			//MOV Rx, Rx Between High Registers Does Nothing At All
+			uint16_t highRd = ((opcode >> 4) & 0x8) | Rd;
+			if ((opcode & 0xFF00) == 0x4600 && ((opcode >> 3) & 0xF) == highRd && highRd != 15)
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The TST Instruction On This Line Has Invalid Parameters" << std::endl;
-				return false;
+				removed[i] = true;
+				rewrites.emplace_back(i, "Removed " + DescribeInstruction(opcode) + ", Which Does Nothing");
+				break;
 			}
-		}
-		else if (instruction == "NOP")
-		{
-			currentLine.erase(0, 3);
-			if (!ProcessNOPInstruction(currentLine))
+
+			//MOV Rx, Rx (ADD Rx, Rx, #0) And The Comparisons Only Set Flags, So They Can Go If The Flags Are Set Again Before They Are Read
+			uint8_t flags = 0;
+			if (opcode == (0x1C00 | Rd << 3 | Rd))
+				flags = ASSEMBLER_FLAGS_NZCV;
+			else if ((opcode & 0xF800) == 0x2800 || (opcode & 0xFF80) == 0x4280 || (opcode & 0xFF00) == 0x4500)
+				flags = ASSEMBLER_FLAGS_NZCV;
+			else if ((opcode & 0xFFC0) == 0x4200)
+				flags = ASSEMBLER_FLAGS_NZ;
+			if (flags != 0 && AreFlagsDead(run, i + 1, flags))
 			{
-				inputStream.close();
-				outputStream.close();
-				std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-				std::cout << "The NOP Instruction On This Line Should Not Have Any Parameters" << std::endl;
-				return false;
+				removed[i] = true;
+				rewrites.emplace_back(i, "Removed " + DescribeInstruction(opcode) + ", Whose Flags Are Set Again Before They Are Read");
+				break;
 			}
-		}
-		else
-		{
-			inputStream.close();
-			outputStream.close();
-			std::cout << "Error on Line " << currentLineNumber << " in " << relativePath << std::endl;
-			std::cout << "The Instruction On This Line Is Invalid" << std::endl;
-			return false;
-		}
 
+			if (kept.empty())
+				break;
+			size_t p = kept.back();
+			uint16_t previous = run[p];
+
+			//MOV, ADD Or SUB #a Followed By ADD Or SUB #b On The Same Register Fold Into One Instruction
+			//N And Z Come Out The Same Either Way, C And V Do Not, So They Must Be Set Again Before They Are Read
+			uint16_t operation = (opcode >> 11) & 0x3;
+			uint16_t previousOperation = (previous >> 11) & 0x3;
+			if ((opcode & 0xE000) == 0x2000 && (previous & 0xE000) == 0x2000 && (operation == 0x2 || operation == 0x3) && previousOperation != 0x1 && ((opcode ^ previous) & 0x0700) == 0)
+			{
+				int64_t value = (previousOperation == 0x3) ? -(int64_t)(previous & 0xFF) : (int64_t)(previous & 0xFF);
+				value += (operation == 0x3) ? -(int64_t)(opcode & 0xFF) : (int64_t)(opcode & 0xFF);
+
+				uint16_t folded = 0;
+				if (previousOperation == 0x0 && value >= 0 && value <= 255)
+					folded = 0x2000 | (opcode & 0x0700) | (uint16_t)value;
+				else if (previousOperation != 0x0 && value >= 0 && value <= 255)
+					folded = 0x3000 | (opcode & 0x0700) | (uint16_t)value;
+				else if (previousOperation != 0x0 && value < 0 && value >= -255)
+					folded = 0x3800 | (opcode & 0x0700) | (uint16_t)-value;
+
+				if (folded != 0 && AreFlagsDead(run, i + 1, ASSEMBLER_FLAGS_CV))
+				{
+					run[i] = folded;
+					removed[p] = true;
+					kept.pop_back();
+					rewrites.emplace_back(i, "Folded " + DescribeInstruction(previous) + " And " + DescribeInstruction(opcode) + " Into " + DescribeInstruction(folded));
+					rewritten = true;
+				}
+			}
+		}
 
-		//11. Put Line In Output File
-		outputStream.write(currentLine.c_str(), currentLine.size());
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
-		currentInstructionNumber++;
+		if (!removed[i])
+			kept.push_back(i);
 	}
-
-	inputStream.close();
-	outputStream.close();
-	std::cout << "Successfully PreProcessed " << relativePath << "..." << std::endl;
-	return true;
 }
 
-static bool Assemble(const std::filesystem::path& sourcePath, const std::filesystem::path& intermediatePath)
+//--peephole Rewrites Every Run Of Instructions Between Labels And Placeholders, Branches Only Land On Labels And CALLs Return Right After A Placeholder
+//So Nothing Can Jump Into The Middle Of A Run, Removed Instructions Are Then Taken Out Of Their Section Just Like With --gc
+static void OptimizePeephole(std::vector<PeepholeRewriteInfo>& rewrites)
 {
-	std::fstream inputStream;
-	std::fstream outputStream;
-	size_t indexOfEntryPoint;
+	uint64_t amountOfFiles = s_SectionMap.size();
+
+	//Every File Gets One Slot Per Instruction And One For Its End, Which Labels Can Point To As Well
+	std::vector<uint64_t> firstSlot(amountOfFiles + 1, 0);
+	for (size_t f = 0; f < amountOfFiles; f++)
+		firstSlot[f + 1] = firstSlot[f] + s_SectionMap[f].size() + 1;
+
+	std::vector<bool> isPlaceholder(firstSlot.back(), false);
+	for (const BranchInfo& branch : s_BranchMap)
+		std::fill_n(isPlaceholder.begin() + firstSlot[branch.fileNumber] + branch.InstructionNumber, branch.placeholderSize, true);
+	for (const MovAddressInfo& movAddress : s_MovAddressMap)
+		std::fill_n(isPlaceholder.begin() + firstSlot[movAddress.fileNumber] + movAddress.InstructionNumber, movAddress.placeholderSize, true);
+	for (const LiteralPoolInfo& literalPool : s_LiteralPoolMap)
+		std::fill_n(isPlaceholder.begin() + firstSlot[literalPool.fileNumber] + literalPool.InstructionNumber, LiteralPoolSize(literalPool), true);
+
+	std::vector<const std::string*> labelNames(s_LabelMap.size(), nullptr);
+	for (const SymbolInfo& symbol : s_SymbolTable.slots)
+	{
+		if (!symbol.name.empty() && symbol.type == ASSEMBLER_SYMBOL_LABEL)
+			labelNames[symbol.index] = &symbol.name;
+	}
+	std::vector<const std::string*> labelAt(firstSlot.back(), nullptr);
+	for (size_t l = 0; l < s_LabelMap.size(); l++)
+		labelAt[firstSlot[s_LabelMap[l].fileNumber] + s_LabelMap[l].instructionNumber] = labelNames[l];
+
+	std::vector<bool> isRemoved(firstSlot.back(), false);
+	std::vector<uint16_t> run;
+	std::vector<uint64_t> runPositions;
+	std::vector<bool> runRemoved;
+	std::vector<std::pair<size_t, std::string>> runRewrites;
+	for (size_t f = 0; f < amountOfFiles; f++)
+	{
+		std::vector<uint16_t>& section = s_SectionMap[f];
+		const std::string* label = nullptr;
+		for (uint64_t n = 0; n <= section.size(); n++)
+		{
+			uint64_t slot = firstSlot[f] + n;
+			if (n == section.size() || isPlaceholder[slot] || labelAt[slot] != nullptr)
+			{
+				if (!run.empty())
+				{
+					runRemoved.assign(run.size(), false);
+					runRewrites.clear();
+					OptimizeRun(run, runRemoved, runRewrites);
+					for (size_t k = 0; k < run.size(); k++)
+					{
+						section[runPositions[k]] = run[k];
+						isRemoved[firstSlot[f] + runPositions[k]] = runRemoved[k];
+					}
+					for (const std::pair<size_t, std::string>& rewrite : runRewrites)
+						rewrites.push_back({ f, runPositions[rewrite.first], (label != nullptr) ? *label : std::string(), rewrite.second });
+					run.clear();
+					runPositions.clear();
+				}
+				if (labelAt[slot] != nullptr)
+					label = labelAt[slot];
+			}
+			if (n < section.size() && !isPlaceholder[slot])
+			{
+				run.push_back(section[n]);
+				runPositions.push_back(n);
+			}
+		}
+	}
 
-	for (indexOfEntryPoint = 0; indexOfEntryPoint < s_LabelMap.size(); indexOfEntryPoint++)
+	//Every Instruction Moves Back By The Amount Of Removed Instructions Before It In Its Section
+	std::vector<uint64_t> removedBefore(firstSlot.back(), 0);
+	for (size_t f = 0; f < amountOfFiles; f++)
 	{
-		if (s_LabelMap[indexOfEntryPoint].label == "ENTRY")
-			break;
+		std::vector<uint16_t>& section = s_SectionMap[f];
+		uint64_t removed = 0;
+		for (uint64_t n = 0; n <= section.size(); n++)
+		{
+			removedBefore[firstSlot[f] + n] = removed;
+			if (n == section.size())
+				break;
+			if (isRemoved[firstSlot[f] + n])
+				removed++;
+			else
+				section[n - removed] = section[n];
+		}
+		section.resize(section.size() - removed);
+		s_BuildStats.peepholeRemovedBytes += removed * ASSEMBLER_INSTRUCTION_BYTE_SIZE;
 	}
 
-	if (indexOfEntryPoint == s_LabelMap.size())
+	for (LabelInfo& label : s_LabelMap)
+		label.instructionNumber -= removedBefore[firstSlot[label.fileNumber] + label.instructionNumber];
+	for (BranchInfo& branch : s_BranchMap)
+		branch.InstructionNumber -= removedBefore[firstSlot[branch.fileNumber] + branch.InstructionNumber];
+	for (MovAddressInfo& movAddress : s_MovAddressMap)
+		movAddress.InstructionNumber -= removedBefore[firstSlot[movAddress.fileNumber] + movAddress.InstructionNumber];
+	for (LiteralPoolInfo& literalPool : s_LiteralPoolMap)
+		literalPool.InstructionNumber -= removedBefore[firstSlot[literalPool.fileNumber] + literalPool.InstructionNumber];
+	for (PeepholeRewriteInfo& rewrite : rewrites)
+		rewrite.instructionNumber -= removedBefore[firstSlot[rewrite.fileNumber] + rewrite.instructionNumber];
+	s_BuildStats.peepholeRewrites = rewrites.size();
+}
+
+static bool Assemble(const std::filesystem::path& sourcePath)
+{
+	SymbolInfo* entryPointSymbol = FindSymbol(s_SymbolTable, "ENTRY");
+	if (entryPointSymbol == nullptr || entryPointSymbol->type != ASSEMBLER_SYMBOL_LABEL)
 	{
 		std::cout << "Error In Assembling..." << std::endl;
 		std::cout << "The Entry Point is Not Defined, Add The Label ENTRY To Where You Want The Program To Start" << std::endl;
@@ -3118,364 +4071,332 @@ static bool Assemble(const std::filesystem::path& sourcePath, const std::filesys
 	}
 
 	//Join All The Files That Need To Be Joined
+	//The Joins Form A Forest, Every File Is Joined Into At Most One Other And Follows It Along With Everything Joined Into It
+	//"joinedFiles[joinedFilesStart[f]]" Up To "joinedFiles[joinedFilesStart[f + 1]]" Are The Files Joined Into File f, In The Order They Were Joined
+	uint64_t amountOfFiles = s_SectionMap.size();
+	std::vector<uint64_t> joinedInto(amountOfFiles, UINT64_MAX);
+	std::vector<uint64_t> joinedFilesStart(amountOfFiles + 1, 0);
 	for (size_t i = 0; i < s_JoinMap.size(); i++)
 	{
-		std::filesystem::path parentFile = intermediatePath;
-		std::filesystem::path childFile = intermediatePath;
-		uint64_t originalAmountOfParentFileInstructions = 0;
-		uint64_t fileCounter = 0;
-		for (const auto& dirEntry : std::filesystem::recursive_directory_iterator(intermediatePath))
+		if (joinedInto[s_JoinMap[i].childFile] != UINT64_MAX)
 		{
-			if (dirEntry.is_directory())
-				continue;
+			std::cout << "Error In Assembling..." << std::endl;
+			std::cout << "The ~join Preprocessor Directives Join " << s_SourceFilePathMap[s_JoinMap[i].childFile] << " More Than Once" << std::endl;
+			return false;
+		}
+		joinedInto[s_JoinMap[i].childFile] = s_JoinMap[i].parentFile;
+		joinedFilesStart[s_JoinMap[i].parentFile + 1]++;
+	}
+	for (size_t f = 0; f < amountOfFiles; f++)
+		joinedFilesStart[f + 1] += joinedFilesStart[f];
 
-			if (s_JoinMap[i].parentFile == fileCounter)
-			{
-				parentFile = dirEntry.path();
-				originalAmountOfParentFileInstructions = dirEntry.file_size() / ASSEMBLER_INSTRUCTION_CHAR_SIZE;
-				if (childFile != intermediatePath)
-					break;
-			}
-			else if (s_JoinMap[i].childFile == fileCounter)
-			{
-				childFile = dirEntry.path();
-				if (parentFile != intermediatePath)
-					break;
-			}
+	std::vector<uint64_t> joinedFiles(s_JoinMap.size());
+	std::vector<uint64_t> amountOfJoinedFiles(amountOfFiles, 0);
+	for (size_t i = 0; i < s_JoinMap.size(); i++)
+	{
+		uint64_t parentFile = s_JoinMap[i].parentFile;
+		joinedFiles[joinedFilesStart[parentFile] + amountOfJoinedFiles[parentFile]++] = s_JoinMap[i].childFile;
+	}
 
-			fileCounter++;
+	//Files That Are Not Joined Into Another Keep Their Order, Each Followed Depth First By The Files Joined Into It
+	std::vector<uint64_t> fileOrder;
+	fileOrder.reserve(amountOfFiles);
+	std::vector<uint64_t> pendingFiles;
+	for (size_t f = 0; f < amountOfFiles; f++)
+	{
+		if (joinedInto[f] != UINT64_MAX)
+			continue;
+		pendingFiles.push_back(f);
+		while (!pendingFiles.empty())
+		{
+			uint64_t file = pendingFiles.back();
+			pendingFiles.pop_back();
+			fileOrder.push_back(file);
+			for (uint64_t j = joinedFilesStart[file + 1]; j > joinedFilesStart[file]; j--)
+				pendingFiles.push_back(joinedFiles[j - 1]);
 		}
+	}
 
-		inputStream.open(childFile, std::ios::in | std::ios::binary);
-		outputStream.open(parentFile, std::ios::out | std::ios::binary | std::ios::app);
+	//A File Never Reached Is Joined Into Itself Through The Files It Joins
+	if (fileOrder.size() != amountOfFiles)
+	{
+		std::vector<bool> placed(amountOfFiles, false);
+		for (size_t f = 0; f < fileOrder.size(); f++)
+			placed[fileOrder[f]] = true;
+		size_t f = 0;
+		while (placed[f])
+			f++;
+		std::cout << "Error In Assembling..." << std::endl;
+		std::cout << "The ~join Preprocessor Directives Join " << s_SourceFilePathMap[f] << " Into Itself" << std::endl;
+		return false;
+	}
+	EndBuildStage("Join");
 
-		char nextByte;
-		while (inputStream.read(&nextByte, 1))
-			outputStream.write(&nextByte, 1);
+	//Unreachable Code And Data Is Taken Out Before Anything Is Copied Or Laid Out
+	if (s_BuildOptions.collectGarbage)
+	{
+		CollectGarbage(fileOrder, s_LabelMap[entryPointSymbol->index]);
+		std::cout << "Removed " << s_BuildStats.removedLabels << " Unreachable Labels (" << s_BuildStats.removedCodeBytes << " Bytes Of Code), " << s_BuildStats.removedByteSequences << " Byte Sequences And " << s_BuildStats.removedPtrSequences << " Pointer Sequences (" << s_BuildStats.removedDataBytes << " Bytes Of Data)" << std::endl;
+		EndBuildStage("Garbage Collection");
+	}
 
-		inputStream.close();
-		outputStream.close();
+	//Redundant Instructions Are Rewritten While Every Section Still Has Its Labels, Which Mark Everywhere A Branch Can Land
+	std::vector<PeepholeRewriteInfo> peepholeRewrites;
+	if (s_BuildOptions.optimizePeephole)
+	{
+		OptimizePeephole(peepholeRewrites);
+		EndBuildStage("Peephole");
+	}
 
-		std::filesystem::remove(childFile);
+	//Combine All Files Into One
+	//Every Section Is Copied Straight To Its Final Place, And Each Map Is Fixed In A Single Pass
+	std::vector<uint64_t> fileStart(amountOfFiles);
+	uint64_t amountOfInstructions = 0;
+	for (size_t f = 0; f < fileOrder.size(); f++)
+	{
+		fileStart[fileOrder[f]] = amountOfInstructions;
+		amountOfInstructions += s_SectionMap[fileOrder[f]].size();
+	}
 
-		//Fix The Label Map
-		for (size_t l = 0; l < s_LabelMap.size(); l++)
-		{
-			if (s_LabelMap[l].fileNumber == s_JoinMap[i].childFile)
-			{
-				s_LabelMap[l].fileNumber = s_JoinMap[i].parentFile;
-				s_LabelMap[l].instructionNumber += originalAmountOfParentFileInstructions;
-			}
-			if (s_LabelMap[l].fileNumber > s_JoinMap[i].childFile)
-				s_LabelMap[l].fileNumber--;
-		}
+	std::vector<uint16_t> instructions(amountOfInstructions);
+	for (size_t f = 0; f < amountOfFiles; f++)
+		std::copy(s_SectionMap[f].begin(), s_SectionMap[f].end(), instructions.begin() + fileStart[f]);
+	s_SectionMap.clear();
+	EndBuildStage("Combine");
 
-		//Fix The Branch Map
-		for (size_t b = 0; b < s_BranchMap.size(); b++)
+	//Resolve Branch Targets
+	std::vector<uint64_t> branchTargets(s_BranchMap.size());
+	for (size_t i = 0; i < s_BranchMap.size(); i++)
+	{
+		SymbolInfo* symbol = FindSymbol(s_SymbolTable, s_BranchMap[i].label);
+		if (symbol == nullptr)
 		{
-			if (s_BranchMap[b].fileNumber == s_JoinMap[i].childFile)
-			{
-				s_BranchMap[b].fileNumber = s_JoinMap[i].parentFile;
-				s_BranchMap[b].InstructionNumber += originalAmountOfParentFileInstructions;
-			}
-			if (s_BranchMap[b].fileNumber > s_JoinMap[i].childFile)
-				s_BranchMap[b].fileNumber--;
+			std::cout << "Error In Assembling..." << std::endl;
+			std::cout << "The Label " << s_BranchMap[i].label << " Is Not Defined" << std::endl;
+			return false;
 		}
-
-		//Fix The MovAddress Map
-		for (size_t m = 0; m < s_MovAddressMap.size(); m++)
+		if (symbol->type == ASSEMBLER_SYMBOL_BYTE_SEQUENCE)
 		{
-			if (s_MovAddressMap[m].fileNumber == s_JoinMap[i].childFile)
-			{
-				s_MovAddressMap[m].fileNumber = s_JoinMap[i].parentFile;
-				s_MovAddressMap[m].InstructionNumber += originalAmountOfParentFileInstructions;
-			}
-			if (s_MovAddressMap[m].fileNumber > s_JoinMap[i].childFile)
-				s_MovAddressMap[m].fileNumber--;
+			std::cout << "Error In Assembling..." << std::endl;
+			std::cout << "The Label " << s_BranchMap[i].label << " Is A Byte Sequence, Which Can Not Be Branched To" << std::endl;
+			return false;
 		}
-
-		//Fix The Join Map
-		for (size_t j = i + 1; j < s_JoinMap.size(); j++)
+		if (symbol->type == ASSEMBLER_SYMBOL_PTR_SEQUENCE)
 		{
-			if (s_JoinMap[j].parentFile > s_JoinMap[i].childFile)
-				s_JoinMap[j].parentFile--;
-			if (s_JoinMap[j].childFile > s_JoinMap[i].childFile)
-				s_JoinMap[j].childFile--;
+			std::cout << "Error In Assembling..." << std::endl;
+			std::cout << "The Label " << s_BranchMap[i].label << " Is A Pointer Sequence, Which Can Not Be Branched To" << std::endl;
+			return false;
 		}
+		branchTargets[i] = symbol->index;
 	}
 
-	//Combine All Files Into One
-	std::filesystem::path combinedFilePath;
-	uint64_t fileCounter = 0;
-	for (const auto& dirEntry : std::filesystem::recursive_directory_iterator(intermediatePath))
+	//Add One Veneer Per Called Label After The Code, In A Section Of Their Own
+	//A Called Label Expects The Return Address To Already Be Pushed, So The Veneer Does "PUSH {LR}" And Then Branches To The Label
+	//This Lets Each CALL Be A Single BL To The Veneer
+	uint64_t veneerSection = amountOfFiles;
+	fileStart.push_back(instructions.size());
+	std::vector<uint64_t> veneerOfLabel(s_LabelMap.size(), UINT64_MAX);
+	std::vector<uint64_t> veneerOfBranch(s_BranchMap.size(), UINT64_MAX);
+	size_t amountOfSourceBranches = s_BranchMap.size();
+	for (size_t i = 0; i < amountOfSourceBranches; i++)
 	{
-		if (dirEntry.is_directory())
+		if (s_BranchMap[i].type != ASSEMBLER_BRANCH_LINK)
 			continue;
 
-		if (fileCounter == 0)
-			combinedFilePath = dirEntry.path();
-		else
+		if (veneerOfLabel[branchTargets[i]] == UINT64_MAX)
 		{
-			size_t originalAmountOfParentFileInstructions = std::filesystem::file_size(combinedFilePath) / ASSEMBLER_INSTRUCTION_CHAR_SIZE;
+			veneerOfLabel[branchTargets[i]] = s_BranchMap.size();
+			s_BranchMap.push_back({ ASSEMBLER_BRANCH_VENEER, veneerSection, instructions.size() - fileStart[veneerSection], s_BranchMap[i].label, ASSEMBLER_PLACEHOLDER_SIZE_VENEER });
+			branchTargets.push_back(branchTargets[i]);
+			instructions.insert(instructions.end(), ASSEMBLER_PLACEHOLDER_SIZE_VENEER, 0);
+		}
+		veneerOfBranch[i] = veneerOfLabel[branchTargets[i]];
+	}
 
-			inputStream.open(dirEntry.path(), std::ios::in | std::ios::binary);
-			outputStream.open(combinedFilePath, std::ios::out | std::ios::binary | std::ios::app);
+	s_BuildStats.branches = amountOfSourceBranches;
+	s_BuildStats.veneers = s_BranchMap.size() - amountOfSourceBranches;
+	s_BuildStats.movAddresses = s_MovAddressMap.size();
+	s_BuildStats.literalPools = s_LiteralPoolMap.size();
+
+	//Relax Branches And MOV Addresses
+	//Every Placeholder Starts In Its Shortest Form And Grows Until Its Target Is In Range, Since Nothing Ever Shrinks This Always Settles
+	std::vector<RelaxationInfo> relaxations;
+	relaxations.reserve(s_BranchMap.size() + s_MovAddressMap.size());
+	for (size_t i = 0; i < s_BranchMap.size(); i++)
+		relaxations.push_back({ fileStart[s_BranchMap[i].fileNumber] + s_BranchMap[i].InstructionNumber, s_BranchMap[i].placeholderSize, ShortestBranchSize(s_BranchMap[i].type), i, UINT64_MAX });
+	for (size_t m = 0; m < s_MovAddressMap.size(); m++)
+	{
+		uint64_t relaxedSize = s_MovAddressMap[m].placeholderSize;
+		if (s_MovAddressMap[m].literalPool != UINT64_MAX)
+			relaxedSize = ASSEMBLER_RELAXED_SIZE_MOV_ADDRESS;
+		relaxations.push_back({ fileStart[s_MovAddressMap[m].fileNumber] + s_MovAddressMap[m].InstructionNumber, s_MovAddressMap[m].placeholderSize, relaxedSize, UINT64_MAX, m });
+	}
+	std::sort(relaxations.begin(), relaxations.end(), [](const RelaxationInfo& a, const RelaxationInfo& b) { return a.InstructionNumber < b.InstructionNumber; });
 
-			char nextByte;
-			while (inputStream.read(&nextByte, 1))
-				outputStream.write(&nextByte, 1);
+	std::vector<uint64_t> removedBefore(relaxations.size() + 1, 0);
+	bool placeholderGrew = true;
+	while (placeholderGrew)
+	{
+		placeholderGrew = false;
+		for (size_t k = 0; k < relaxations.size(); k++)
+			removedBefore[k + 1] = removedBefore[k] + relaxations[k].placeholderSize - relaxations[k].relaxedSize;
 
-			inputStream.close();
-			outputStream.close();
+		for (size_t k = 0; k < relaxations.size(); k++)
+		{
+			int64_t instructionNumber = relaxations[k].InstructionNumber - removedBefore[k];
+			uint64_t relaxedSize = relaxations[k].relaxedSize;
 
-			//Fix The Label Map
-			for (size_t l = 0; l < s_LabelMap.size(); l++)
+			if (relaxations[k].branch != UINT64_MAX)
 			{
-				if (s_LabelMap[l].fileNumber == fileCounter)
-				{
-					s_LabelMap[l].fileNumber = 0;
-					s_LabelMap[l].instructionNumber += originalAmountOfParentFileInstructions;
-				}
-			}
+				size_t b = relaxations[k].branch;
+				const LabelInfo& target = s_LabelMap[branchTargets[b]];
+				int64_t targetNumber = RelaxInstructionNumber(fileStart[target.fileNumber] + target.instructionNumber, relaxations, removedBefore);
+				if (s_BranchMap[b].type == ASSEMBLER_BRANCH_LINK)
+					targetNumber = RelaxInstructionNumber(fileStart[veneerSection] + s_BranchMap[veneerOfBranch[b]].InstructionNumber, relaxations, removedBefore);
 
-			//Fix The Branch Map
-			for (size_t b = 0; b < s_BranchMap.size(); b++)
+				relaxedSize = RelaxBranchSize(s_BranchMap[b], instructionNumber, targetNumber, relaxedSize);
+			}
+			else if (relaxedSize == ASSEMBLER_RELAXED_SIZE_MOV_ADDRESS)
 			{
-				if (s_BranchMap[b].fileNumber == fileCounter)
-				{
-					s_BranchMap[b].fileNumber = 0;
-					s_BranchMap[b].InstructionNumber += originalAmountOfParentFileInstructions;
-				}
+				//LDR Rd, [PC, #imm] Only Reaches Forwards From The Word-Aligned PC
+				const MovAddressInfo& movAddress = s_MovAddressMap[relaxations[k].movAddress];
+				const LiteralPoolInfo& literalPool = s_LiteralPoolMap[movAddress.literalPool];
+				uint64_t entryNumber = LiteralPoolEntryNumber(literalPool, RelaxInstructionNumber(fileStart[literalPool.fileNumber] + literalPool.InstructionNumber, relaxations, removedBefore), movAddress.literalPoolEntry);
+				int64_t offset = 2 * (int64_t)entryNumber - ((2 * instructionNumber + 4) & ~3);
+				if (!IsOffsetInRange(offset, 0, ASSEMBLER_LITERAL_OFFSET_MAX))
+					relaxedSize = relaxations[k].placeholderSize;
 			}
 
-			//Fix The MovAddress Map
-			for (size_t m = 0; m < s_MovAddressMap.size(); m++)
+			if (relaxedSize != relaxations[k].relaxedSize)
 			{
-				if (s_MovAddressMap[m].fileNumber == fileCounter)
-				{
-					s_MovAddressMap[m].fileNumber = 0;
-					s_MovAddressMap[m].InstructionNumber += originalAmountOfParentFileInstructions;
-				}
+				relaxations[k].relaxedSize = relaxedSize;
+				placeholderGrew = true;
 			}
 		}
+	}
 
-		fileCounter++;
+	//Shrink The Placeholders
+	std::vector<uint16_t> relaxedInstructions;
+	relaxedInstructions.reserve(instructions.size() - removedBefore.back());
+	uint64_t copiedUpTo = 0;
+	for (size_t k = 0; k < relaxations.size(); k++)
+	{
+		relaxedInstructions.insert(relaxedInstructions.end(), instructions.begin() + copiedUpTo, instructions.begin() + relaxations[k].InstructionNumber);
+		relaxedInstructions.insert(relaxedInstructions.end(), relaxations[k].relaxedSize, 0);
+		copiedUpTo = relaxations[k].InstructionNumber + relaxations[k].placeholderSize;
+	}
+	relaxedInstructions.insert(relaxedInstructions.end(), instructions.begin() + copiedUpTo, instructions.end());
+
+	instructions = std::move(relaxedInstructions);
+
+	//Resolve Every Section-Relative Position To Its Final Instruction Number, Once The Sections And Placeholders Are Settled
+	std::vector<uint64_t> labelNumbers(s_LabelMap.size());
+	for (size_t l = 0; l < s_LabelMap.size(); l++)
+		labelNumbers[l] = RelaxInstructionNumber(fileStart[s_LabelMap[l].fileNumber] + s_LabelMap[l].instructionNumber, relaxations, removedBefore);
+	std::vector<uint64_t> literalPoolNumbers(s_LiteralPoolMap.size());
+	for (size_t p = 0; p < s_LiteralPoolMap.size(); p++)
+		literalPoolNumbers[p] = RelaxInstructionNumber(fileStart[s_LiteralPoolMap[p].fileNumber] + s_LiteralPoolMap[p].InstructionNumber, relaxations, removedBefore);
+	std::vector<uint64_t> branchNumbers(s_BranchMap.size());
+	std::vector<uint64_t> branchSizes(s_BranchMap.size());
+	std::vector<uint64_t> movAddressNumbers(s_MovAddressMap.size());
+	std::vector<uint64_t> movAddressSizes(s_MovAddressMap.size());
+	for (size_t k = 0; k < relaxations.size(); k++)
+	{
+		if (relaxations[k].branch != UINT64_MAX)
+		{
+			branchNumbers[relaxations[k].branch] = relaxations[k].InstructionNumber - removedBefore[k];
+			branchSizes[relaxations[k].branch] = relaxations[k].relaxedSize;
+		}
+		else
+		{
+			movAddressNumbers[relaxations[k].movAddress] = relaxations[k].InstructionNumber - removedBefore[k];
+			movAddressSizes[relaxations[k].movAddress] = relaxations[k].relaxedSize;
+		}
 	}
 
+	EndBuildStage("Relaxation");
+
+	//Branch Around Literal Pools That Execution Could Fall Into
+	for (size_t p = 0; p < s_LiteralPoolMap.size(); p++)
+	{
+		if (s_LiteralPoolMap[p].skipped)
+			instructions[literalPoolNumbers[p]] = EncodeBranch(literalPoolNumbers[p], literalPoolNumbers[p] + LiteralPoolSize(s_LiteralPoolMap[p]));
+	}
 
 	//Evaluate Branchs
-	outputStream.open(combinedFilePath, std::ios::in | std::ios::out | std::ios::binary);
 	for (size_t i = 0; i < s_BranchMap.size(); i++)
 	{
-		size_t l;
-		for (l = 0; l < s_LabelMap.size(); l++)
-		{
-			if (s_LabelMap[l].label == s_BranchMap[i].label)
-				break;
-		}
-		if (l == s_LabelMap.size())
+		uint64_t patchIndex = branchNumbers[i];
+		uint64_t targetNumber = labelNumbers[branchTargets[i]];
+
+		if (s_BranchMap[i].type == ASSEMBLER_BRANCH_VENEER)
 		{
-			size_t j;
-			for (j = 0; j < s_ByteSequenceMap.size(); j++)
+			//PUSH {LR}
+			instructions[patchIndex++] = 0b1011010100000000;
+
+			if (branchSizes[i] == ASSEMBLER_RELAXED_SIZE_VENEER)
 			{
-				if (s_ByteSequenceMap[j].label == s_BranchMap[i].label)
-				{
-					std::cout << "Error In Assembling..." << std::endl;
-					std::cout << "The Label " << s_BranchMap[i].label << " Is A Byte Sequence, Which Can Not Be Branched To" << std::endl;
-					j = s_ByteSequenceMap.size() + 1;
-				}
+				instructions[patchIndex] = EncodeBranch(patchIndex, targetNumber);
+				continue;
 			}
-			for (j = 0; j < s_PtrSequenceMap.size(); j++)
+			if (branchSizes[i] == ASSEMBLER_RELAXED_SIZE_VENEER_LINK)
 			{
-				if (s_PtrSequenceMap[j].label == s_BranchMap[i].label)
-				{
-					std::cout << "Error In Assembling..." << std::endl;
-					std::cout << "The Label " << s_BranchMap[i].label << " Is A Pointer Sequence, Which Can Not Be Branched To" << std::endl;
-					j = s_PtrSequenceMap.size() + 1;
-				}
+				EncodeLinkBranch(instructions, patchIndex, targetNumber);
+				continue;
 			}
-			if (j == s_ByteSequenceMap.size())
+		}
+		else if (s_BranchMap[i].type == ASSEMBLER_BRANCH_AL)
+		{
+			if (branchSizes[i] == ASSEMBLER_RELAXED_SIZE_BRANCH)
 			{
-				std::cout << "Error In Assembling..." << std::endl;
-				std::cout << "The Label " << s_BranchMap[i].label << " Is Not Defined" << std::endl;
+				instructions[patchIndex] = EncodeBranch(patchIndex, targetNumber);
+				continue;
 			}
-
-			return false;
 		}
-
-		uint64_t pointer = s_LabelMap[l].instructionNumber;
-		pointer *= 2;
-		pointer += 0x08000000;
-		pointer += 192;
-		pointer += 28;
-		pointer &= (UINT32_MAX - 1);
-		pointer++;
-
-		outputStream.seekp(ASSEMBLER_INSTRUCTION_CHAR_SIZE * s_BranchMap[i].InstructionNumber);
-		if (s_BranchMap[i].type != ASSEMBLER_BRANCH_AL)
+		else if (s_BranchMap[i].type == ASSEMBLER_BRANCH_LINK)
 		{
-			if (s_BranchMap[i].type == ASSEMBLER_BRANCH_LINK)
+			if (branchSizes[i] == ASSEMBLER_RELAXED_SIZE_LINK_BRANCH)
 			{
-				//Link
-
-				char linkingBranchSymbols[16];
-
-				linkingBranchSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[10] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[11] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[12] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[13] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[14] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[15] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				outputStream.write(linkingBranchSymbols, 16);
-
-#ifdef ASSEMBLER_CONFIG_DEBUG
-				outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
-
-				linkingBranchSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[10] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[11] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[12] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[13] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[14] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[15] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				outputStream.write(linkingBranchSymbols, 16);
-
-#ifdef ASSEMBLER_CONFIG_DEBUG
-				outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
-
-				linkingBranchSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[10] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[11] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[12] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[13] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[14] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[15] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				outputStream.write(linkingBranchSymbols, 16);
-
-#ifdef ASSEMBLER_CONFIG_DEBUG
-				outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
+				EncodeLinkBranch(instructions, patchIndex, branchNumbers[veneerOfBranch[i]]);
+				continue;
+			}
 
-				linkingBranchSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				linkingBranchSymbols[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[10] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[11] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[12] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[13] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[14] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				linkingBranchSymbols[15] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				outputStream.write(linkingBranchSymbols, 16);
+			//Link
 
-#ifdef ASSEMBLER_CONFIG_DEBUG
-				outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
+			instructions[patchIndex++] = 0b1111000000000000;
+			instructions[patchIndex++] = 0b1111100000000001;
+			instructions[patchIndex++] = 0b1110000000001000;
+			instructions[patchIndex++] = 0b1011010100000000;
+		}
+		else
+		{
+			if (branchSizes[i] == ASSEMBLER_RELAXED_SIZE_CONDITIONAL_BRANCH)
+			{
+				instructions[patchIndex] = EncodeConditionalBranch(s_BranchMap[i].type, patchIndex, targetNumber);
+				continue;
 			}
-			else
+			if (branchSizes[i] == ASSEMBLER_RELAXED_SIZE_CONDITIONAL_SKIP)
 			{
-				//Find out the Condition
-
-				char conditionalBranchSymbols[16];
-
-				conditionalBranchSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				conditionalBranchSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				conditionalBranchSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				if (s_BranchMap[i].type & 0b1000)
-					conditionalBranchSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				else
-					conditionalBranchSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-
-				if (s_BranchMap[i].type & 0b0100)
-					conditionalBranchSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				else
-					conditionalBranchSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_0;
-
-				if (s_BranchMap[i].type & 0b0010)
-					conditionalBranchSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				else
-					conditionalBranchSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_0;
-
-				if (s_BranchMap[i].type & 0b0001)
-					conditionalBranchSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				else
-					conditionalBranchSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-
-				conditionalBranchSymbols[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[10] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[11] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[12] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[13] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[14] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[15] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				outputStream.write(conditionalBranchSymbols, 16);
-
-#ifdef ASSEMBLER_CONFIG_DEBUG
-				outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
+				//Skip The B With The Opposite Condition
+				instructions[patchIndex] = EncodeConditionalBranch(s_BranchMap[i].type ^ 1, patchIndex, patchIndex + 2);
+				instructions[patchIndex + 1] = EncodeBranch(patchIndex + 1, targetNumber);
+				continue;
+			}
 
-				conditionalBranchSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				conditionalBranchSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				conditionalBranchSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				conditionalBranchSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[10] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[11] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[12] = ASSEMBLER_OUTPUT_SYMBOL_0;
-				conditionalBranchSymbols[13] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				conditionalBranchSymbols[14] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				conditionalBranchSymbols[15] = ASSEMBLER_OUTPUT_SYMBOL_1;
-				outputStream.write(conditionalBranchSymbols, 16);
+			//Find out the Condition
 
-#ifdef ASSEMBLER_CONFIG_DEBUG
-				outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
-			}
+			instructions[patchIndex++] = (uint16_t)(0b1101000000000000 | (s_BranchMap[i].type << 8));
+			instructions[patchIndex++] = 0b1110000000000111;
 		}
 
+		uint64_t pointer = targetNumber;
+		pointer *= 2;
+		pointer += 0x08000000;
+		pointer += ASSEMBLER_ROM_HEADER_SIZE;
+		pointer += ASSEMBLER_ROM_START_CODE_SIZE;
+		pointer &= (UINT32_MAX - 1);
+		pointer++;
+
 		/*
 		[Byte1, Byte2, Byte3, Byte4] = address+1
 
@@ -3506,770 +4427,1347 @@ static bool Assemble(const std::filesystem::path& sourcePath, const std::filesys
 		00111000
 		*/
 
-		char newSymbols[16];
-
 		//MOV R7, Byte1
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		for (size_t i = 8; i < 16; i++)
-		{
-			if (pointer & (0x80000000 >> (i - 8)))
-				newSymbols[i] = ASSEMBLER_OUTPUT_SYMBOL_1;
-			else
-				newSymbols[i] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		}
-		outputStream.write(newSymbols, 16);
-
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
+		instructions[patchIndex++] = (uint16_t)(0b0010011100000000 | ((pointer & 0xFF000000) >> 24));
 
 		//LSL R7, R7, #8
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[10] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[11] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[12] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[13] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[14] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[15] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		outputStream.write(newSymbols, 16);
-
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
+		instructions[patchIndex++] = 0b0000001000111111;
 
 		//ADD R7, Byte2
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		for (size_t i = 8; i < 16; i++)
-		{
-			if (pointer & (0x00800000 >> (i - 8)))
-				newSymbols[i] = ASSEMBLER_OUTPUT_SYMBOL_1;
-			else
-				newSymbols[i] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		}
-		outputStream.write(newSymbols, 16);
-
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
+		instructions[patchIndex++] = (uint16_t)(0b0011011100000000 | ((pointer & 0x00FF0000) >> 16));
 
 		//LSL R7, R7, #8
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[10] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[11] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[12] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[13] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[14] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[15] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		outputStream.write(newSymbols, 16);
-
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
+		instructions[patchIndex++] = 0b0000001000111111;
 
 		//ADD R7, Byte3
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		for (size_t i = 8; i < 16; i++)
-		{
-			if (pointer & (0x00008000 >> (i - 8)))
-				newSymbols[i] = ASSEMBLER_OUTPUT_SYMBOL_1;
-			else
-				newSymbols[i] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		}
-		outputStream.write(newSymbols, 16);
-
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
+		instructions[patchIndex++] = (uint16_t)(0b0011011100000000 | ((pointer & 0x0000FF00) >> 8));
 
 		//LSL R7, R7, #8
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[10] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[11] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[12] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[13] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[14] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[15] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		outputStream.write(newSymbols, 16);
-
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
+		instructions[patchIndex++] = 0b0000001000111111;
 
 		//ADD R7, Byte4
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		for (size_t i = 8; i < 16; i++)
-		{
-			if (pointer & (0x00000080 >> (i - 8)))
-				newSymbols[i] = ASSEMBLER_OUTPUT_SYMBOL_1;
-			else
-				newSymbols[i] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		}
-		outputStream.write(newSymbols, 16);
-
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
+		instructions[patchIndex++] = (uint16_t)(0b0011011100000000 | (pointer & 0x000000FF));
 
 		//BX R7
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[10] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[11] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[12] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[13] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[14] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[15] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		outputStream.write(newSymbols, 16);
+		instructions[patchIndex++] = 0b0100011100111000;
+	}
 
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
+	EndBuildStage("Evaluate Branches");
+
+	//Each Rewrite Is Reported At Its Address In The ROM, So It Can Be Checked Against A Disassembly
+	//The Report Is Built In One Stream And Printed Once, As Flushing Every Line Takes Longer Than The Rewrites Themselves
+	if (s_BuildOptions.optimizePeephole)
+	{
+		std::ostringstream peepholeReport;
+		for (const PeepholeRewriteInfo& rewrite : peepholeRewrites)
+		{
+			uint64_t address = 0x08000000 + ASSEMBLER_ROM_HEADER_SIZE + ASSEMBLER_ROM_START_CODE_SIZE;
+			address += 2 * RelaxInstructionNumber(fileStart[rewrite.fileNumber] + rewrite.instructionNumber, relaxations, removedBefore);
+			peepholeReport << "Peephole At 0x" << std::hex << std::uppercase << std::setw(8) << std::setfill('0') << address << std::dec << std::nouppercase << std::setfill(' ') << " In " << s_SourceFilePathMap[rewrite.fileNumber];
+			if (!rewrite.label.empty())
+				peepholeReport << " After " << rewrite.label;
+			peepholeReport << ": " << rewrite.description << '\n';
+		}
+		peepholeReport << "Made " << s_BuildStats.peepholeRewrites << " Peephole Rewrites, Removing " << s_BuildStats.peepholeRemovedBytes << " Bytes Of Code\n";
+		std::cout << peepholeReport.str() << std::flush;
+		EndBuildStage("Peephole Report");
 	}
-	outputStream.close();
+
+	//Compression Comes First, As Data Is Merged And Laid Out By What Ends Up In The ROM
+	if (!CompressByteSequences(sourcePath))
+		return false;
+	EndBuildStage("Compression");
 
 	//Evaluate Byte Sequence Offsets
-	size_t numberOfBytes = std::filesystem::file_size(combinedFilePath);
-	numberOfBytes /= ASSEMBLER_INSTRUCTION_CHAR_SIZE;
-	numberOfBytes *= 2;
+	size_t numberOfBytes = instructions.size() * ASSEMBLER_INSTRUCTION_BYTE_SIZE;
 
-	for (size_t i = 0; i < s_ByteSequenceMap.size(); i++)
-	{
-		s_ByteSequenceMap[i].address = 0x08000000;
-		s_ByteSequenceMap[i].address += 192;
-		s_ByteSequenceMap[i].address += 28;
-		s_ByteSequenceMap[i].address += numberOfBytes;
-		uint64_t amountLeadingZeros = s_ByteSequenceMap[i].address % s_ByteSequenceMap[i].alignment;
-		amountLeadingZeros = s_ByteSequenceMap[i].alignment - amountLeadingZeros;
-		if (amountLeadingZeros == s_ByteSequenceMap[i].alignment)
-			amountLeadingZeros = 0;
-		for (size_t j = 0; j < amountLeadingZeros; j++)
-			s_ByteSequenceMap[i].bytes.insert(s_ByteSequenceMap[i].bytes.begin(), 0);
-		s_ByteSequenceMap[i].address += amountLeadingZeros;
-		numberOfBytes += s_ByteSequenceMap[i].bytes.size();
-	}
-
-	//Evaluate Ptr Sequence Pointers & Offsets
+	std::vector<uint64_t> byteSequenceHosts;
+	std::vector<uint64_t> byteSequenceHostOffsets;
+	if (s_BuildOptions.mergeData)
+		MergeByteSequences(byteSequenceHosts, byteSequenceHostOffsets);
+
+	//Pointer Sequences Are Sized Up Front So They Can Be Laid Out Alongside The Byte Sequences They Point To
 	for (size_t i = 0; i < s_PtrSequenceMap.size(); i++)
 	{
+		uint64_t amountPointers = 0;
 		for (size_t k = 0; k < s_PtrSequenceMap[i].pointers.size(); k++)
 		{
-			for (size_t b = 0; b < s_ByteSequenceMap.size(); b++)
+			SymbolInfo* symbol = FindSymbol(s_SymbolTable, s_PtrSequenceMap[i].pointers[k]);
+			if (symbol == nullptr)
+				continue;
+
+			if (symbol->type == ASSEMBLER_SYMBOL_BYTE_SEQUENCE)
 			{
-				if (s_PtrSequenceMap[i].pointers[k] == s_ByteSequenceMap[b].label)
-				{
-					s_PtrSequenceMap[i].bytes.push_back((char)(s_ByteSequenceMap[b].address & 0x000000FF));
-					s_PtrSequenceMap[i].bytes.push_back((char)((s_ByteSequenceMap[b].address & 0x0000FF00) >> 8));
-					s_PtrSequenceMap[i].bytes.push_back((char)((s_ByteSequenceMap[b].address & 0x00FF0000) >> 16));
-					s_PtrSequenceMap[i].bytes.push_back((char)((s_ByteSequenceMap[b].address & 0xFF000000) >> 24));
-					b = s_ByteSequenceMap.size();
-				}
+				amountPointers++;
 			}
-			for (size_t l = 0; l < s_LabelMap.size(); l++)
+			else if (symbol->type == ASSEMBLER_SYMBOL_LABEL)
 			{
-				if (s_PtrSequenceMap[i].pointers[k] == s_LabelMap[l].label)
-				{
-					std::cout << "Error In Assembling..." << std::endl;
-					std::cout << "The Label " << s_LabelMap[i].label << " Is An Instruction Label, Which Can Not Be Converted To A Pointer" << std::endl;
-					return false;
-				}
+				std::cout << "Error In Assembling..." << std::endl;
+				std::cout << "The Label " << s_PtrSequenceMap[i].pointers[k] << " Is An Instruction Label, Which Can Not Be Converted To A Pointer" << std::endl;
+				return false;
 			}
 		}
+		s_PtrSequenceMap[i].bytes.resize(amountPointers * 4);
+	}
+
+	//Indices Past The Byte Sequences Are Pointer Sequences, Which Are Word Aligned
+	//Merged Sequences Take Up No Space Of Their Own
+	std::vector<DataLayoutInfo> dataLayout(s_ByteSequenceMap.size() + s_PtrSequenceMap.size());
+	for (size_t i = 0; i < s_ByteSequenceMap.size(); i++)
+	{
+		bool merged = !byteSequenceHosts.empty() && byteSequenceHosts[i] != i;
+		dataLayout[i] = { s_ByteSequenceMap[i].alignment, ByteSequenceSize(s_ByteSequenceMap[i]), 0, merged };
+	}
+	for (size_t i = 0; i < s_PtrSequenceMap.size(); i++)
+		dataLayout[s_ByteSequenceMap.size() + i] = { 4, s_PtrSequenceMap[i].bytes.size(), 0, false };
+
+	uint64_t dataStart = 0x08000000 + ASSEMBLER_ROM_HEADER_SIZE + ASSEMBLER_ROM_START_CODE_SIZE + numberOfBytes;
+	numberOfBytes += LayOutData(dataLayout, dataStart, s_BuildStats.dataPaddingBytes) - dataStart;
+	for (size_t i = 0; i < s_ByteSequenceMap.size(); i++)
+		s_ByteSequenceMap[i].address = dataLayout[i].address;
+	for (size_t i = 0; i < s_PtrSequenceMap.size(); i++)
+		s_PtrSequenceMap[i].address = dataLayout[s_ByteSequenceMap.size() + i].address;
+
+	//A Host Can Come After What It Hosts, So Merged Addresses Are Filled In Once Every Host Is Placed
+	for (size_t i = 0; i < byteSequenceHosts.size(); i++)
+	{
+		if (byteSequenceHosts[i] != i)
+		{
+			s_ByteSequenceMap[i].address = s_ByteSequenceMap[byteSequenceHosts[i]].address + byteSequenceHostOffsets[i];
+			s_ByteSequenceMap[i].bytes.clear();
+		}
+	}
 
-		s_PtrSequenceMap[i].address = 0x08000000;
-		s_PtrSequenceMap[i].address += 192;
-		s_PtrSequenceMap[i].address += 28;
-		s_PtrSequenceMap[i].address += numberOfBytes;
-		uint64_t amountLeadingZeros = s_PtrSequenceMap[i].address % 4;
-		amountLeadingZeros = 4 - amountLeadingZeros;
-		if (amountLeadingZeros == 4)
-			amountLeadingZeros = 0;
-		for (size_t j = 0; j < amountLeadingZeros; j++)
-			s_PtrSequenceMap[i].bytes.insert(s_PtrSequenceMap[i].bytes.begin(), 0);
-		s_PtrSequenceMap[i].address += amountLeadingZeros;
-		numberOfBytes += s_PtrSequenceMap[i].bytes.size();
+	//Evaluate Ptr Sequence Pointers
+	for (size_t i = 0; i < s_PtrSequenceMap.size(); i++)
+	{
+		char* pointerBytes = s_PtrSequenceMap[i].bytes.data();
+		for (size_t k = 0; k < s_PtrSequenceMap[i].pointers.size(); k++)
+		{
+			SymbolInfo* symbol = FindSymbol(s_SymbolTable, s_PtrSequenceMap[i].pointers[k]);
+			if (symbol == nullptr || symbol->type != ASSEMBLER_SYMBOL_BYTE_SEQUENCE)
+				continue;
+
+			uint64_t byteSequenceAddress = s_ByteSequenceMap[symbol->index].address;
+			*pointerBytes++ = (char)(byteSequenceAddress & 0x000000FF);
+			*pointerBytes++ = (char)((byteSequenceAddress & 0x0000FF00) >> 8);
+			*pointerBytes++ = (char)((byteSequenceAddress & 0x00FF0000) >> 16);
+			*pointerBytes++ = (char)((byteSequenceAddress & 0xFF000000) >> 24);
+		}
 	}
 
+	s_BuildStats.byteSequences = s_ByteSequenceMap.size();
+	s_BuildStats.ptrSequences = s_PtrSequenceMap.size();
+	EndBuildStage("Byte And Pointer Sequence Layout");
+
 	//Translate The MOV Address Instructions
-	outputStream.open(combinedFilePath, std::ios::in | std::ios::out | std::ios::binary);
 	for (size_t i = 0; i < s_MovAddressMap.size(); i++)
 	{
-		size_t j = 0;
+		//Memory Region Offsets Were Already Checked In PreProcess
 		uint64_t address = UINT64_MAX;
-		for (; j < s_LabelMap.size(); j++)
+		FindMemoryAddress(s_MovAddressMap[i].label, address);
+		if (address == UINT64_MAX)
 		{
-			if (s_MovAddressMap[i].label.substr(0, 8) == "MEM_BIOS")
-			{
-				address = ASSEMBLER_MEM_BIOS;
-				if (s_MovAddressMap[i].label.size() >= 9)
-				{
-					int index = StringToDecimalInt(s_MovAddressMap[i].label.substr(8));
-					if (!s_SuccessfulIntConversion || index < 0)
-					{
-						std::cout << "Error In Assembling..." << std::endl;
-						std::cout << "The Label " << s_MovAddressMap[i].label << " Is Not Defined" << std::endl;
-						return false;
-					}
-					address += index;
-				}
-				break;
-			}
-			if (s_MovAddressMap[i].label.substr(0, 8) == "MEM_ERAM")
-			{
-				address = ASSEMBLER_MEM_ERAM;
-				if (s_MovAddressMap[i].label.size() >= 9)
-				{
-					int index = StringToDecimalInt(s_MovAddressMap[i].label.substr(8));
-					if (!s_SuccessfulIntConversion || index < 0)
-					{
-						std::cout << "Error In Assembling..." << std::endl;
-						std::cout << "The Label " << s_MovAddressMap[i].label << " Is Not Defined" << std::endl;
-						return false;
-					}
-					address += index;
-				}
-				break;
-			}
-			if (s_MovAddressMap[i].label.substr(0, 8) == "MEM_IRAM")
-			{
-				address = ASSEMBLER_MEM_IRAM;
-				if (s_MovAddressMap[i].label.size() >= 9)
-				{
-					int index = StringToDecimalInt(s_MovAddressMap[i].label.substr(8));
-					if (!s_SuccessfulIntConversion || index < 0)
-					{
-						std::cout << "Error In Assembling..." << std::endl;
-						std::cout << "The Label " << s_MovAddressMap[i].label << " Is Not Defined" << std::endl;
-						return false;
-					}
-					address += index;
-				}
-				break;
-			}
-			if (s_MovAddressMap[i].label.substr(0, 6) == "MEM_IO")
-			{
-				address = ASSEMBLER_MEM_IO;
-				if (s_MovAddressMap[i].label.size() >= 7)
-				{
-					int index = StringToDecimalInt(s_MovAddressMap[i].label.substr(6));
-					if (!s_SuccessfulIntConversion || index < 0)
-					{
-						std::cout << "Error In Assembling..." << std::endl;
-						std::cout << "The Label " << s_MovAddressMap[i].label << " Is Not Defined" << std::endl;
-						return false;
-					}
-					address += index;
-				}
-				break;
-			}
-			if (s_MovAddressMap[i].label.substr(0, 11) == "MEM_PALETTE")
-			{
-				address = ASSEMBLER_MEM_PALETTE;
-				if (s_MovAddressMap[i].label.size() >= 12)
-				{
-					int index = StringToDecimalInt(s_MovAddressMap[i].label.substr(11));
-					if (!s_SuccessfulIntConversion || index < 0)
-					{
-						std::cout << "Error In Assembling..." << std::endl;
-						std::cout << "The Label " << s_MovAddressMap[i].label << " Is Not Defined" << std::endl;
-						return false;
-					}
-					address += index;
-				}
-				break;
-			}
-			if (s_MovAddressMap[i].label.substr(0, 12) == "MEM_OPALETTE")
-			{
-				address = ASSEMBLER_MEM_PALETTE + 512;
-				if (s_MovAddressMap[i].label.size() >= 13)
-				{
-					int index = StringToDecimalInt(s_MovAddressMap[i].label.substr(12));
-					if (!s_SuccessfulIntConversion || index < 0)
-					{
-						std::cout << "Error In Assembling..." << std::endl;
-						std::cout << "The Label " << s_MovAddressMap[i].label << " Is Not Defined" << std::endl;
-						return false;
-					}
-					address += index;
-				}
-				break;
-			}
-			if (s_MovAddressMap[i].label.substr(0, 8) == "MEM_VRAM")
-			{
-				address = ASSEMBLER_MEM_VRAM;
-				if (s_MovAddressMap[i].label.size() >= 9)
-				{
-					int index = StringToDecimalInt(s_MovAddressMap[i].label.substr(8));
-					if (!s_SuccessfulIntConversion || index < 0)
-					{
-						std::cout << "Error In Assembling..." << std::endl;
-						std::cout << "The Label " << s_MovAddressMap[i].label << " Is Not Defined" << std::endl;
-						return false;
-					}
-					address += index;
-				}
-				break;
-			}
-			if (s_MovAddressMap[i].label.substr(0, 9) == "MEM_OVRAM")
-			{
-				address = ASSEMBLER_MEM_VRAM + 65536;
-				if (s_MovAddressMap[i].label.size() >= 10)
-				{
-					int index = StringToDecimalInt(s_MovAddressMap[i].label.substr(9));
-					if (!s_SuccessfulIntConversion || index < 0)
-					{
-						std::cout << "Error In Assembling..." << std::endl;
-						std::cout << "The Label " << s_MovAddressMap[i].label << " Is Not Defined" << std::endl;
-						return false;
-					}
-					address += index;
-				}
-				break;
-			}
-			if (s_MovAddressMap[i].label.substr(0, 7) == "MEM_OAM")
-			{
-				address = ASSEMBLER_MEM_OAM;
-				if (s_MovAddressMap[i].label.size() >= 8)
-				{
-					int index = StringToDecimalInt(s_MovAddressMap[i].label.substr(7));
-					if (!s_SuccessfulIntConversion || index < 0)
-					{
-						std::cout << "Error In Assembling..." << std::endl;
-						std::cout << "The Label " << s_MovAddressMap[i].label << " Is Not Defined" << std::endl;
-						return false;
-					}
-					address += index;
-				}
-				break;
-			}
-			if (s_MovAddressMap[i].label.substr(0, 7) == "MEM_ROM")
+			SymbolInfo* symbol = FindSymbol(s_SymbolTable, s_MovAddressMap[i].label);
+			if (symbol == nullptr)
 			{
-				address = ASSEMBLER_MEM_ROM;
-				if (s_MovAddressMap[i].label.size() >= 8)
-				{
-					int index = StringToDecimalInt(s_MovAddressMap[i].label.substr(7));
-					if (!s_SuccessfulIntConversion || index < 0)
-					{
-						std::cout << "Error In Assembling..." << std::endl;
-						std::cout << "The Label " << s_MovAddressMap[i].label << " Is Not Defined" << std::endl;
-						return false;
-					}
-					address += index;
-				}
-				break;
+				std::cout << "Error In Assembling..." << std::endl;
+				std::cout << "The Label " << s_MovAddressMap[i].label << " Is Not Defined" << std::endl;
+				return false;
 			}
 
-			if (s_MovAddressMap[i].label == s_LabelMap[j].label)
+			if (symbol->type == ASSEMBLER_SYMBOL_LABEL)
 			{
-				address = s_LabelMap[j].instructionNumber;
+				address = labelNumbers[symbol->index];
 				address *= 2;
 				address += 0x08000000;
-				address += 192;
-				address += 28;
-				break;
+				address += ASSEMBLER_ROM_HEADER_SIZE;
+				address += ASSEMBLER_ROM_START_CODE_SIZE;
 			}
-		}
-		if (address == UINT64_MAX)
-		{
-			for (j = 0; j < s_ByteSequenceMap.size(); j++)
+			else if (symbol->type == ASSEMBLER_SYMBOL_BYTE_SEQUENCE)
 			{
-				if (s_MovAddressMap[i].label == s_ByteSequenceMap[j].label)
-				{
-					address = s_ByteSequenceMap[j].address;
-					break;
-				}
+				address = s_ByteSequenceMap[symbol->index].address;
 			}
-			if (address == UINT64_MAX)
+			else
 			{
-				for (j = 0; j < s_PtrSequenceMap.size(); j++)
-				{
-					if (s_MovAddressMap[i].label == s_PtrSequenceMap[j].label)
-					{
-						address = s_PtrSequenceMap[j].address;
-						break;
-					}
-				}
-				if (address == UINT64_MAX)
-				{
-					std::cout << "Error In Assembling..." << std::endl;
-					std::cout << "The Label " << s_MovAddressMap[i].label << " Is Not Defined" << std::endl;
-					return false;
-				}
+				address = s_PtrSequenceMap[symbol->index].address;
 			}
 		}
-		outputStream.seekp(s_MovAddressMap[i].InstructionNumber * ASSEMBLER_INSTRUCTION_CHAR_SIZE);
+		uint64_t patchIndex = movAddressNumbers[i];
 
-		char destinationRegisterSymbols[3];
-		char newSymbols[16];
+		uint16_t destinationRegister = (uint16_t)s_MovAddressMap[i].destinationRegister;
 
-		if (s_MovAddressMap[i].destinationRegister & 4)
-			destinationRegisterSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		else
-			destinationRegisterSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		if (s_MovAddressMap[i].destinationRegister & 2)
-			destinationRegisterSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		else
-			destinationRegisterSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		if (s_MovAddressMap[i].destinationRegister & 1)
-			destinationRegisterSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		else
-			destinationRegisterSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_0;
+		if (movAddressSizes[i] == ASSEMBLER_RELAXED_SIZE_MOV_ADDRESS)
+		{
+			uint64_t literalPool = s_MovAddressMap[i].literalPool;
+			uint64_t entryNumber = LiteralPoolEntryNumber(s_LiteralPoolMap[literalPool], literalPoolNumbers[literalPool], s_MovAddressMap[i].literalPoolEntry);
+			instructions[entryNumber] = (uint16_t)(address & 0x0000FFFF);
+			instructions[entryNumber + 1] = (uint16_t)((address & 0xFFFF0000) >> 16);
+
+			//LDR Rd, [PC, #imm]
+			uint64_t offset = 2 * entryNumber - ((2 * patchIndex + 4) & ~3);
+			instructions[patchIndex] = (uint16_t)(0b0100100000000000 | (destinationRegister << 8) | (offset >> 2));
+			continue;
+		}
 
 		//MOV Rd, Byte1
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = destinationRegisterSymbols[0];
-		newSymbols[6] = destinationRegisterSymbols[1];
-		newSymbols[7] = destinationRegisterSymbols[2];
-		for (size_t k = 8; k < 16; k++)
-		{
-			if (address & (0x80000000 >> (k - 8)))
-				newSymbols[k] = ASSEMBLER_OUTPUT_SYMBOL_1;
-			else
-				newSymbols[k] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		}
-		outputStream.write(newSymbols, 16);
+		instructions[patchIndex++] = (uint16_t)(0b0010000000000000 | (destinationRegister << 8) | ((address & 0xFF000000) >> 24));
 
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
+		//LSL Rd, Rd, #8
+		instructions[patchIndex++] = 0b0000001000000000 | (destinationRegister << 3) | destinationRegister;
+
+		//ADD Rd, Byte2
+		instructions[patchIndex++] = (uint16_t)(0b0011000000000000 | (destinationRegister << 8) | ((address & 0x00FF0000) >> 16));
 
 		//LSL Rd, Rd, #8
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[10] = destinationRegisterSymbols[0];
-		newSymbols[11] = destinationRegisterSymbols[1];
-		newSymbols[12] = destinationRegisterSymbols[2];
-		newSymbols[13] = destinationRegisterSymbols[0];
-		newSymbols[14] = destinationRegisterSymbols[1];
-		newSymbols[15] = destinationRegisterSymbols[2];
-		outputStream.write(newSymbols, 16);
+		instructions[patchIndex++] = 0b0000001000000000 | (destinationRegister << 3) | destinationRegister;
 
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
+		//ADD Rd, Byte3
+		instructions[patchIndex++] = (uint16_t)(0b0011000000000000 | (destinationRegister << 8) | ((address & 0x0000FF00) >> 8));
+
+		//LSL Rd, Rd, #8
+		instructions[patchIndex++] = 0b0000001000000000 | (destinationRegister << 3) | destinationRegister;
+
+		//ADD Rd, Byte4
+		instructions[patchIndex++] = (uint16_t)(0b0011000000000000 | (destinationRegister << 8) | (address & 0x000000FF));
+	}
+
+
+	EndBuildStage("MOVA Translation");
+
+	//Assemble
+	//The Whole ROM Is Built In Memory At Its Final Size, Already Padded To A Power Of Two, And Written To Disk In One Go
+	size_t romSize = ASSEMBLER_ROM_HEADER_SIZE + ASSEMBLER_ROM_START_CODE_SIZE + numberOfBytes;
+	size_t paddedFileSize = std::bit_ceil(romSize);
+	std::vector<char> romImage(paddedFileSize);
+	WriteROMHeader(romImage.data());
+
+	uint64_t addressOfEntryPoint = labelNumbers[entryPointSymbol->index];
+	addressOfEntryPoint *= 2;
+	addressOfEntryPoint += 0x08000000;
+	addressOfEntryPoint += ASSEMBLER_ROM_HEADER_SIZE;
+	addressOfEntryPoint += ASSEMBLER_ROM_START_CODE_SIZE;
+	addressOfEntryPoint &= (UINT32_MAX - 1);
+	addressOfEntryPoint++;
+
+	char* startCode = romImage.data() + ASSEMBLER_ROM_HEADER_SIZE;
+	char startInstructions[4];
+
+	//MOV R12, #0x08000000
+	startInstructions[0] = (char)0b00000010;
+	startInstructions[1] = (char)0b11000011;
+	startInstructions[2] = (char)0b10100000;
+	startInstructions[3] = (char)0b11100011;
+	std::memcpy(startCode, startInstructions, 4);
+	startCode += 4;
+
+	//ADD R12, R12, #205
+	startInstructions[0] = (char)0b11001101;
+	startInstructions[1] = (char)0b11000000;
+	startInstructions[2] = (char)0b10001100;
+	startInstructions[3] = (char)0b11100010;
+	std::memcpy(startCode, startInstructions, 4);
+	startCode += 4;
+
+	//BX R12
+	startInstructions[0] = (char)0b00011100;
+	startInstructions[1] = (char)0b11111111;
+	startInstructions[2] = (char)0b00101111;
+	startInstructions[3] = (char)0b11100001;
+	std::memcpy(startCode, startInstructions, 4);
+	startCode += 4;
+
+	//MOV R7, Byte1 & LSL R7, R7, #8
+	startInstructions[0] = (char)((addressOfEntryPoint & 0xFF000000) >> 24);
+	startInstructions[1] = (char)0b00100111;
+	startInstructions[2] = (char)0b00111111;
+	startInstructions[3] = (char)0b00000010;
+	std::memcpy(startCode, startInstructions, 4);
+	startCode += 4;
+
+	//ADD R7, Byte2 & LSL R7, R7, #8
+	startInstructions[0] = (char)((addressOfEntryPoint & 0x00FF0000) >> 16);
+	startInstructions[1] = (char)0b00110111;
+	startInstructions[2] = (char)0b00111111;
+	startInstructions[3] = (char)0b00000010;
+	std::memcpy(startCode, startInstructions, 4);
+	startCode += 4;
+
+	//ADD R7, Byte3 & LSL R7, R7, #8
+	startInstructions[0] = (char)((addressOfEntryPoint & 0x0000FF00) >> 8);
+	startInstructions[1] = (char)0b00110111;
+	startInstructions[2] = (char)0b00111111;
+	startInstructions[3] = (char)0b00000010;
+	std::memcpy(startCode, startInstructions, 4);
+	startCode += 4;
+
+	//ADD R7, Byte4 & BX R7
+	startInstructions[0] = (char)(addressOfEntryPoint & 0x000000FF);
+	startInstructions[1] = (char)0b00110111;
+	startInstructions[2] = (char)0b00111000;
+	startInstructions[3] = (char)0b01000111;
+	std::memcpy(startCode, startInstructions, 4);
+	startCode += 4;
+
+	for (size_t i = 0; i < instructions.size(); i++)
+		WriteInstruction(startCode + i * 2, instructions[i]);
+
+	//Data Is Copied Straight To Its Address, Whatever Lies Between Is Alignment Padding And Stays Zero
+	for (size_t i = 0; i < s_ByteSequenceMap.size(); i++)
+	{
+		const ByteSequenceInfo& byteSequence = s_ByteSequenceMap[i];
+		if (byteSequence.includedPath.empty())
+		{
+			std::copy(byteSequence.bytes.begin(), byteSequence.bytes.end(), romImage.begin() + (byteSequence.address - 0x08000000));
+			continue;
+		}
+
+		//Included Files Are Read Straight Into Place, They Are Never Held Anywhere Else
+		std::ifstream includedStream(sourcePath / byteSequence.includedPath, std::ios::in | std::ios::binary);
+		includedStream.seekg(byteSequence.includedOffset);
+		includedStream.read(romImage.data() + (byteSequence.address - 0x08000000), byteSequence.includedSize);
+		if (!includedStream)
+		{
+			std::cout << "Error In Assembling..." << std::endl;
+			std::cout << "Could Not Read " << byteSequence.includedSize << " Bytes From " << byteSequence.includedPath << ", Which Was Included By ~incbin" << std::endl;
+			return false;
+		}
+		s_BuildStats.includedBytes += byteSequence.includedSize;
+	}
+
+	for (size_t i = 0; i < s_PtrSequenceMap.size(); i++)
+		std::copy(s_PtrSequenceMap[i].bytes.begin(), s_PtrSequenceMap[i].bytes.end(), romImage.begin() + (s_PtrSequenceMap[i].address - 0x08000000));
+
+	//Pad The ROM To A Power Of Two
+	std::memset(romImage.data() + romSize, 0xFF, paddedFileSize - romSize);
+	s_BuildStats.paddingBytes = paddedFileSize - romSize;
+	s_BuildStats.romBytes = paddedFileSize;
+	EndBuildStage("Pack");
+
+	//An Emulator Watching MyGame.gba Only Ever Sees The Old ROM Or The New One
+	if (!WriteFileAtomically(sourcePath / "MyGame.gba", std::string_view(romImage.data(), romImage.size())))
+	{
+		std::cout << "Error In Assembling..." << std::endl;
+		std::cout << "Could Not Write MyGame.gba" << std::endl;
+		return false;
+	}
+	EndBuildStage("Write");
+
+	std::cout << "Successfully Assembled " << "MyGame.gba" << std::endl;
+	return true;
+}
+
+//Object Files Hold Everything PreProcess Records For One Source File: Its Section, Its Symbols, And The Relocations
+//(Branches, CALLs, MOVAs And Pointer Sequences) That Are Only Filled In Once Every File Has Been Linked Together
+//Values Are Written As LEB128 And Instructions As Little-Endian Halfwords, So An Object File Reads The Same On Any Machine
+static void WriteObjectValue(std::string& object, uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		object.push_back((char)((value & 0x7F) | 0x80));
+		value >>= 7;
+	}
+	object.push_back((char)value);
+}
+
+static void WriteObjectString(std::string& object, std::string_view str)
+{
+	WriteObjectValue(object, str.size());
+	object.append(str);
+}
+
+struct ObjectReaderInfo
+{
+	const char* data;
+	size_t size;
+	size_t position = 0;
+	bool failed = false;
+};
+
+static uint64_t ReadObjectValue(ObjectReaderInfo& reader)
+{
+	uint64_t value = 0;
+	for (uint64_t shift = 0; shift < 64 && reader.position < reader.size; shift += 7)
+	{
+		uint8_t byte = (uint8_t)reader.data[reader.position++];
+		value |= (uint64_t)(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0)
+			return value;
+	}
+	reader.failed = true;
+	return 0;
+}
+
+//Every Counted Item Takes At Least One Byte, So A Count Larger Than What Is Left Means The Object File Is Damaged
+static uint64_t ReadObjectCount(ObjectReaderInfo& reader)
+{
+	uint64_t count = ReadObjectValue(reader);
+	if (count > reader.size - reader.position)
+	{
+		reader.failed = true;
+		return 0;
+	}
+	return count;
+}
+
+static std::string ReadObjectString(ObjectReaderInfo& reader)
+{
+	uint64_t size = ReadObjectValue(reader);
+	if (reader.size - reader.position < size)
+	{
+		reader.failed = true;
+		return std::string();
+	}
+	std::string str(reader.data + reader.position, size);
+	reader.position += size;
+	return str;
+}
+
+//Joined Files Are Kept In The Header By Path, So What A File Joins Can Be Read Without Reading The Rest Of It
+//Files Included By ~incbin Are Kept There Too, Along With Their Size, So The Build Cache Can Check Them Just As Cheaply
+struct ObjectHeaderInfo
+{
+	uint64_t contentHash;
+	std::string relativePath;
+	std::vector<std::string> joinPaths;
+	std::vector<std::pair<std::string, uint64_t>> includedFiles;
+};
+
+//"contentHash" Is The Hash Of The Source Text, Which The Build Cache Checks Before Using An Object File Again
+static std::string WriteObject(const std::filesystem::path& sourcePath, SourceFileInfo& sourceFile, uint64_t contentHash)
+{
+	std::string object;
+
+	//Header
+	object.append(ASSEMBLER_OBJECT_MAGIC);
+	WriteObjectValue(object, ASSEMBLER_OBJECT_FORMAT_VERSION);
+	WriteObjectValue(object, ASSEMBLER_VERSION_MAJOR);
+	WriteObjectValue(object, ASSEMBLER_VERSION_MINOR);
+	WriteObjectValue(object, ASSEMBLER_VERSION_PATCH);
+	WriteObjectValue(object, contentHash);
+	WriteObjectString(object, std::filesystem::relative(sourceFile.path, sourcePath).generic_string());
+	WriteObjectValue(object, sourceFile.joinPaths.size());
+	for (const std::string& joinPath : sourceFile.joinPaths)
+		WriteObjectString(object, joinPath);
+	uint64_t amountIncludedFiles = 0;
+	for (const ByteSequenceInfo& byteSequence : sourceFile.byteSequenceMap)
+		amountIncludedFiles += !byteSequence.includedPath.empty();
+	WriteObjectValue(object, amountIncludedFiles);
+	for (const ByteSequenceInfo& byteSequence : sourceFile.byteSequenceMap)
+	{
+		if (byteSequence.includedPath.empty())
+			continue;
+		WriteObjectString(object, byteSequence.includedPath);
+		WriteObjectValue(object, byteSequence.includedFileSize);
+	}
+
+	//Section
+	WriteObjectValue(object, sourceFile.section.size());
+	for (uint16_t instruction : sourceFile.section)
+	{
+		object.push_back((char)(instruction & 0xFF));
+		object.push_back((char)(instruction >> 8));
+	}
+
+	//Symbols
+	WriteObjectValue(object, sourceFile.symbolDefinitions.size());
+	for (const SymbolDefinitionInfo& symbolDefinition : sourceFile.symbolDefinitions)
+	{
+		SymbolInfo* symbol = FindSymbol(sourceFile.symbolTable, symbolDefinition.name);
+		WriteObjectString(object, symbolDefinition.name);
+		WriteObjectValue(object, symbolDefinition.lineNumber);
+		WriteObjectValue(object, symbol->type);
+		WriteObjectValue(object, symbol->index);
+	}
+
+	//Maps, File Numbers Are Left Out As They Are Only Given Out When Files Are Linked
+	WriteObjectValue(object, sourceFile.labelMap.size());
+	for (const LabelInfo& label : sourceFile.labelMap)
+		WriteObjectValue(object, label.instructionNumber);
+
+	WriteObjectValue(object, sourceFile.byteSequenceMap.size());
+	for (const ByteSequenceInfo& byteSequence : sourceFile.byteSequenceMap)
+	{
+		WriteObjectString(object, std::string_view(byteSequence.bytes.data(), byteSequence.bytes.size()));
+		WriteObjectValue(object, byteSequence.alignment);
+		WriteObjectValue(object, byteSequence.address);
+		WriteObjectValue(object, byteSequence.compression);
+		WriteObjectString(object, byteSequence.includedPath);
+		WriteObjectValue(object, byteSequence.includedOffset);
+		WriteObjectValue(object, byteSequence.includedSize);
+		WriteObjectValue(object, byteSequence.includedFileSize);
+	}
+
+	WriteObjectValue(object, sourceFile.literalPoolMap.size());
+	for (const LiteralPoolInfo& literalPool : sourceFile.literalPoolMap)
+	{
+		WriteObjectValue(object, literalPool.InstructionNumber);
+		WriteObjectValue(object, literalPool.amountOfEntries);
+		WriteObjectValue(object, literalPool.skipped);
+	}
+
+	//Relocations
+	WriteObjectValue(object, sourceFile.branchMap.size());
+	for (const BranchInfo& branch : sourceFile.branchMap)
+	{
+		WriteObjectValue(object, branch.type);
+		WriteObjectValue(object, branch.InstructionNumber);
+		WriteObjectString(object, branch.label);
+		WriteObjectValue(object, branch.placeholderSize);
+	}
+
+	//"literalPool" Is Written One Higher So UINT64_MAX Takes One Byte Instead Of Ten
+	WriteObjectValue(object, sourceFile.movAddressMap.size());
+	for (const MovAddressInfo& movAddress : sourceFile.movAddressMap)
+	{
+		WriteObjectString(object, movAddress.label);
+		WriteObjectValue(object, movAddress.destinationRegister);
+		WriteObjectValue(object, movAddress.InstructionNumber);
+		WriteObjectValue(object, movAddress.placeholderSize);
+		WriteObjectValue(object, movAddress.literalPool + 1);
+		WriteObjectValue(object, movAddress.literalPoolEntry);
+	}
+
+	WriteObjectValue(object, sourceFile.ptrSequenceMap.size());
+	for (const PtrSequenceInfo& ptrSequence : sourceFile.ptrSequenceMap)
+	{
+		WriteObjectValue(object, ptrSequence.pointers.size());
+		for (const std::string& pointer : ptrSequence.pointers)
+			WriteObjectString(object, pointer);
+		WriteObjectString(object, std::string_view(ptrSequence.bytes.data(), ptrSequence.bytes.size()));
+		WriteObjectValue(object, ptrSequence.address);
+	}
+
+	return object;
+}
+
+//Returns False If The Header Is Damaged Or Was Written By Another Version Of The Assembler
+static bool ReadObjectHeader(ObjectReaderInfo& reader, ObjectHeaderInfo& header)
+{
+	const size_t magicSize = sizeof(ASSEMBLER_OBJECT_MAGIC) - 1;
+	if (reader.size < magicSize || std::string_view(reader.data, magicSize) != ASSEMBLER_OBJECT_MAGIC)
+		return false;
+	reader.position = magicSize;
+
+	if (ReadObjectValue(reader) != ASSEMBLER_OBJECT_FORMAT_VERSION)
+		return false;
+	if (ReadObjectValue(reader) != ASSEMBLER_VERSION_MAJOR || ReadObjectValue(reader) != ASSEMBLER_VERSION_MINOR || ReadObjectValue(reader) != ASSEMBLER_VERSION_PATCH)
+		return false;
+	header.contentHash = ReadObjectValue(reader);
+	header.relativePath = ReadObjectString(reader);
+	header.joinPaths.resize(ReadObjectCount(reader));
+	for (std::string& joinPath : header.joinPaths)
+		joinPath = ReadObjectString(reader);
+	header.includedFiles.resize(ReadObjectCount(reader));
+	for (std::pair<std::string, uint64_t>& includedFile : header.includedFiles)
+	{
+		includedFile.first = ReadObjectString(reader);
+		includedFile.second = ReadObjectValue(reader);
+	}
+	return !reader.failed;
+}
+
+//Reads Everything After The Header, Returns False If The Object File Is Damaged, In Which Case "sourceFile" Is Left As It Was
+static bool ReadObjectBody(ObjectReaderInfo& reader, SourceFileInfo& sourceFile, uint64_t fileNumber)
+{
+	//Section
+	std::vector<uint16_t> section(ReadObjectCount(reader));
+	if (reader.size - reader.position < section.size() * ASSEMBLER_INSTRUCTION_BYTE_SIZE)
+		return false;
+	for (uint16_t& instruction : section)
+	{
+		instruction = (uint16_t)((uint8_t)reader.data[reader.position] | ((uint8_t)reader.data[reader.position + 1] << 8));
+		reader.position += ASSEMBLER_INSTRUCTION_BYTE_SIZE;
+	}
+
+	//Symbols
+	SymbolTable symbolTable;
+	std::vector<SymbolDefinitionInfo> symbolDefinitions(ReadObjectCount(reader));
+	for (SymbolDefinitionInfo& symbolDefinition : symbolDefinitions)
+	{
+		symbolDefinition.name = ReadObjectString(reader);
+		symbolDefinition.lineNumber = ReadObjectValue(reader);
+		uint64_t type = ReadObjectValue(reader);
+		uint64_t index = ReadObjectValue(reader);
+		if (type > ASSEMBLER_SYMBOL_PTR_SEQUENCE)
+			return false;
+		if (reader.failed || symbolDefinition.name.empty() || !AddSymbol(symbolTable, symbolDefinition.name, (ASSEMBLER_SYMBOL_TYPE)type, index))
+			return false;
+	}
+
+	//Maps
+	std::vector<LabelInfo> labelMap(ReadObjectCount(reader));
+	for (LabelInfo& label : labelMap)
+		label = { fileNumber, ReadObjectValue(reader) };
+
+	std::vector<ByteSequenceInfo> byteSequenceMap(ReadObjectCount(reader));
+	for (ByteSequenceInfo& byteSequence : byteSequenceMap)
+	{
+		std::string bytes = ReadObjectString(reader);
+		byteSequence.bytes.assign(bytes.begin(), bytes.end());
+		byteSequence.alignment = ReadObjectValue(reader);
+		byteSequence.address = ReadObjectValue(reader);
+		uint64_t compression = ReadObjectValue(reader);
+		if (compression > ASSEMBLER_COMPRESSION_HUFFMAN)
+			return false;
+		byteSequence.compression = (ASSEMBLER_COMPRESSION_TYPE)compression;
+		byteSequence.includedPath = ReadObjectString(reader);
+		byteSequence.includedOffset = ReadObjectValue(reader);
+		byteSequence.includedSize = ReadObjectValue(reader);
+		byteSequence.includedFileSize = ReadObjectValue(reader);
+	}
+
+	std::vector<LiteralPoolInfo> literalPoolMap(ReadObjectCount(reader));
+	for (LiteralPoolInfo& literalPool : literalPoolMap)
+	{
+		literalPool.fileNumber = fileNumber;
+		literalPool.InstructionNumber = ReadObjectValue(reader);
+		literalPool.amountOfEntries = ReadObjectValue(reader);
+		literalPool.skipped = ReadObjectValue(reader) != 0;
+	}
+
+	//Relocations
+	std::vector<BranchInfo> branchMap(ReadObjectCount(reader));
+	for (BranchInfo& branch : branchMap)
+	{
+		uint64_t type = ReadObjectValue(reader);
+		if (type > ASSEMBLER_BRANCH_LINK)
+			return false;
+		branch.type = (ASSEMBLER_BRANCH_TYPE)type;
+		branch.fileNumber = fileNumber;
+		branch.InstructionNumber = ReadObjectValue(reader);
+		branch.label = ReadObjectString(reader);
+		branch.placeholderSize = ReadObjectValue(reader);
+	}
+
+	std::vector<MovAddressInfo> movAddressMap(ReadObjectCount(reader));
+	for (MovAddressInfo& movAddress : movAddressMap)
+	{
+		movAddress.label = ReadObjectString(reader);
+		uint64_t destinationRegister = ReadObjectValue(reader);
+		if (destinationRegister > 7)
+			return false;
+		movAddress.destinationRegister = (int)destinationRegister;
+		movAddress.fileNumber = fileNumber;
+		movAddress.InstructionNumber = ReadObjectValue(reader);
+		movAddress.placeholderSize = ReadObjectValue(reader);
+		movAddress.literalPool = ReadObjectValue(reader) - 1;
+		movAddress.literalPoolEntry = ReadObjectValue(reader);
+	}
+
+	std::vector<PtrSequenceInfo> ptrSequenceMap(ReadObjectCount(reader));
+	for (PtrSequenceInfo& ptrSequence : ptrSequenceMap)
+	{
+		ptrSequence.pointers.resize(ReadObjectCount(reader));
+		for (std::string& pointer : ptrSequence.pointers)
+			pointer = ReadObjectString(reader);
+		std::string bytes = ReadObjectString(reader);
+		ptrSequence.bytes.assign(bytes.begin(), bytes.end());
+		ptrSequence.address = ReadObjectValue(reader);
+	}
+
+	if (reader.failed || reader.position != reader.size)
+		return false;
+
+	//Every Value Is Checked Before It Is Used As An Index Or A Size, A Damaged Object File Must Never Reach Assemble
+	//Values That Are Narrowed Were Already Checked As They Were Read, Positions Are Checked Against What Is Left Of The Section So Nothing Can Overflow
+	for (const SymbolInfo& symbol : symbolTable.slots)
+	{
+		if (symbol.name.empty())
+			continue;
+		if (symbol.type == ASSEMBLER_SYMBOL_LABEL && symbol.index >= labelMap.size())
+			return false;
+		if (symbol.type == ASSEMBLER_SYMBOL_BYTE_SEQUENCE && symbol.index >= byteSequenceMap.size())
+			return false;
+		if (symbol.type == ASSEMBLER_SYMBOL_PTR_SEQUENCE && symbol.index >= ptrSequenceMap.size())
+			return false;
+	}
+
+	for (const LabelInfo& label : labelMap)
+	{
+		if (label.instructionNumber > section.size())
+			return false;
+	}
+
+	for (const ByteSequenceInfo& byteSequence : byteSequenceMap)
+	{
+		if (byteSequence.alignment == 0 || byteSequence.alignment > ASSEMBLER_MAX_DATA_ALIGNMENT || !std::has_single_bit(byteSequence.alignment))
+			return false;
+		if (byteSequence.includedOffset > byteSequence.includedFileSize || byteSequence.includedSize > byteSequence.includedFileSize - byteSequence.includedOffset)
+			return false;
+	}
+
+	for (const LiteralPoolInfo& literalPool : literalPoolMap)
+	{
+		if (literalPool.amountOfEntries == 0 || literalPool.amountOfEntries > ASSEMBLER_LITERAL_POOL_MAX_ENTRIES)
+			return false;
+		if (literalPool.InstructionNumber > section.size() || LiteralPoolSize(literalPool) > section.size() - literalPool.InstructionNumber)
+			return false;
+	}
+
+	for (const BranchInfo& branch : branchMap)
+	{
+		//Veneers Are Only Made By Assemble, And BNV Is Never Accepted By PreProcess
+		uint64_t placeholderSize = ASSEMBLER_PLACEHOLDER_SIZE_CONDITIONAL_BRANCH;
+		if (branch.type == ASSEMBLER_BRANCH_AL)
+			placeholderSize = ASSEMBLER_PLACEHOLDER_SIZE_BRANCH;
+		else if (branch.type == ASSEMBLER_BRANCH_LINK)
+			placeholderSize = ASSEMBLER_PLACEHOLDER_SIZE_LINK_BRANCH;
+		else if (branch.type > ASSEMBLER_BRANCH_LE)
+			return false;
+		if (branch.placeholderSize != placeholderSize || branch.InstructionNumber > section.size() || placeholderSize > section.size() - branch.InstructionNumber)
+			return false;
+	}
+
+	for (const MovAddressInfo& movAddress : movAddressMap)
+	{
+		if (movAddress.placeholderSize != ASSEMBLER_PLACEHOLDER_SIZE_MOV_ADDRESS || movAddress.InstructionNumber > section.size() || movAddress.placeholderSize > section.size() - movAddress.InstructionNumber)
+			return false;
+		if (movAddress.literalPool != UINT64_MAX && (movAddress.literalPool >= literalPoolMap.size() || movAddress.literalPoolEntry >= literalPoolMap[movAddress.literalPool].amountOfEntries))
+			return false;
+	}
+
+	sourceFile.section = std::move(section);
+	sourceFile.symbolTable = std::move(symbolTable);
+	sourceFile.symbolDefinitions = std::move(symbolDefinitions);
+	sourceFile.labelMap = std::move(labelMap);
+	sourceFile.branchMap = std::move(branchMap);
+	sourceFile.byteSequenceMap = std::move(byteSequenceMap);
+	sourceFile.ptrSequenceMap = std::move(ptrSequenceMap);
+	sourceFile.movAddressMap = std::move(movAddressMap);
+	sourceFile.literalPoolMap = std::move(literalPoolMap);
+	sourceFile.preProcessed = true;
+	return true;
+}
+
+static uint64_t HashSourceFile(const std::filesystem::path& filePath)
+{
+	SourceTextInfo sourceText;
+	if (!LoadSourceText(filePath, sourceText))
+		return 0;
+	return HashSymbolName(std::string_view(sourceText.text, sourceText.size));
+}
+
+#ifdef ASSEMBLER_USE_BUILD_CACHE
+//Named After A Hash Of The Source File's Path, So Renaming A File Misses The Cache But Editing Another Does Not
+static std::filesystem::path CacheFilePath(const std::filesystem::path& cachePath, const std::string& relativePath)
+{
+	std::ostringstream cacheFileName;
+	cacheFileName << std::hex << HashSymbolName(relativePath) << ".cache";
+	return cachePath / cacheFileName.str();
+}
+
+//Cache Files Are Object Files Named After The Source File They Were PreProcessed From
+static void WriteCachedSourceFile(const std::filesystem::path& sourcePath, const std::filesystem::path& cachePath, SourceFileInfo& sourceFile, uint64_t contentHash)
+{
+	std::string object = WriteObject(sourcePath, sourceFile, contentHash);
+	if (WriteFileAtomically(CacheFilePath(cachePath, std::filesystem::relative(sourceFile.path, sourcePath).generic_string()), object))
+		sourceFile.stats.bytesWritten += object.size();
+	sourceFile.cache = std::move(object);
+}
+
+//Returns False If There Is No Usable Cache File, In Which Case "sourceFile" Is Left As It Was
+//A Cache File Already Held In "sourceFile.cache" (In Watch Mode) Is Used Instead Of Reading It Again
+static bool ReadCachedSourceFile(const std::filesystem::path& sourcePath, const std::filesystem::path& cachePath, SourceFileInfo& sourceFile, uint64_t fileNumber, uint64_t contentHash)
+{
+	std::string relativePath = std::filesystem::relative(sourceFile.path, sourcePath).generic_string();
+	if (sourceFile.cache.empty())
+	{
+		SourceTextInfo cacheText;
+		if (!LoadSourceText(CacheFilePath(cachePath, relativePath), cacheText))
+			return false;
+		sourceFile.cache.assign(cacheText.text, cacheText.size);
+		sourceFile.stats.bytesRead += cacheText.size;
+	}
+	ObjectReaderInfo reader = { sourceFile.cache.data(), sourceFile.cache.size() };
+
+	ObjectHeaderInfo header;
+	if (!ReadObjectHeader(reader, header) || header.contentHash != contentHash || header.relativePath != relativePath)
+		return false;
+
+	//A Joined File That Is No Longer There Has To Be Reported With Its Line Number, So That Needs A Fresh PreProcess
+	for (const std::string& joinPath : header.joinPaths)
+	{
+		if (!std::filesystem::exists(sourcePath / joinPath))
+			return false;
+	}
+
+	//So Does An Included File Whose Size Changed, As Its Offset And Length May No Longer Fit, A Change To Its Bytes Alone Is Picked Up When The ROM Is Packed
+	for (const std::pair<std::string, uint64_t>& includedFile : header.includedFiles)
+	{
+		std::error_code includedFileError;
+		if (std::filesystem::file_size(sourcePath / includedFile.first, includedFileError) != includedFile.second || includedFileError)
+			return false;
+	}
+
+	if (!ReadObjectBody(reader, sourceFile, fileNumber))
+		return false;
+	sourceFile.joinPaths = std::move(header.joinPaths);
+	return true;
+}
+#endif
+
+//Merges Every PreProcessed File And Assembles The ROM, The Global Maps Are Left Empty Again Afterwards
+static void AssembleSourceFiles(const std::filesystem::path& sourcePath, std::vector<SourceFileInfo>& sourceFiles)
+{
+	std::unordered_map<std::string, uint64_t> sourceFileNumbers;
+	for (size_t i = 0; i < sourceFiles.size(); i++)
+	{
+		if (!sourceFileNumbers.emplace(std::filesystem::relative(sourceFiles[i].path, sourcePath).generic_string(), i).second)
+		{
+			std::cout << "Error In Assembling..." << std::endl;
+			std::cout << std::filesystem::relative(sourceFiles[i].path, sourcePath) << " Is Given More Than Once" << std::endl;
+			return;
+		}
+	}
+
+	//Merge In File Number Order So The ROM Does Not Depend On Which Thread Finished First
+	bool preprocessedAll = !sourceFiles.empty();
+	for (size_t i = 0; i < sourceFiles.size(); i++)
+	{
+		std::cout << sourceFiles[i].log.str();
+		sourceFiles[i].stats.path = std::filesystem::relative(sourceFiles[i].path, sourcePath).generic_string();
+		s_BuildStats.files.push_back(sourceFiles[i].stats);
+		if (!sourceFiles[i].preProcessed || !MergeSourceFile(sourcePath, sourceFileNumbers, sourceFiles[i], i))
+		{
+			preprocessedAll = false;
+			break;
+		}
+	}
+	sourceFiles.clear();
+	s_BuildStats.symbols = s_SymbolTable.symbolCount;
+	s_BuildStats.symbolTableSlots = s_SymbolTable.slots.size();
+	EndBuildStage("Merge");
+
+	if (preprocessedAll)
+	{
+		std::cout << "Assembling..." << std::endl;
+		Assemble(sourcePath);
+	}
+
+	//The Maps Keep Their Capacity For The Next Build In Watch Mode
+	s_LabelMap.clear();
+	s_BranchMap.clear();
+	s_ByteSequenceMap.clear();
+	s_PtrSequenceMap.clear();
+	s_MovAddressMap.clear();
+	s_LiteralPoolMap.clear();
+	s_JoinMap.clear();
+	s_SectionMap.clear();
+	s_SourceFilePathMap.clear();
+	for (size_t i = 0; i < s_SymbolTable.slots.size(); i++)
+		s_SymbolTable.slots[i].name.clear();
+	s_SymbolTable.symbolCount = 0;
+}
+
+static void FinishFileStats(SourceFileInfo& sourceFile, std::chrono::steady_clock::time_point fileStart)
+{
+	sourceFile.stats.nanoseconds = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - fileStart).count();
+	sourceFile.stats.instructions = sourceFile.section.size();
+	sourceFile.stats.labels = sourceFile.labelMap.size();
+}
+
+//Keeps Claiming The Next Unclaimed File Until Every File Is Claimed Or One Fails To PreProcess
+static void PreProcessWorker(const std::filesystem::path& sourcePath, std::vector<SourceFileInfo>& sourceFiles, std::atomic<size_t>& nextFileNumber, std::atomic<bool>& preProcessFailed)
+{
+	while (!preProcessFailed)
+	{
+		size_t fileNumber = nextFileNumber++;
+		if (fileNumber >= sourceFiles.size())
+			return;
+		SourceFileInfo& sourceFile = sourceFiles[fileNumber];
+		std::chrono::steady_clock::time_point fileStart = std::chrono::steady_clock::now();
+
+#ifdef ASSEMBLER_USE_BUILD_CACHE
+		//Files Whose Text Has Not Changed Since They Were Last PreProcessed Are Taken Straight From The Cache
+		std::filesystem::path cachePath = sourcePath / ASSEMBLER_CACHE_DIRECTORY;
+		uint64_t contentHash = HashSourceFile(sourceFile.path);
+		if (ReadCachedSourceFile(sourcePath, cachePath, sourceFile, fileNumber, contentHash))
+		{
+			sourceFile.log << "Using The Cached PreProcessing Of " << std::filesystem::relative(sourceFile.path, sourcePath) << "..." << std::endl;
+			sourceFile.stats.cached = true;
+			FinishFileStats(sourceFile, fileStart);
+			continue;
+		}
+		sourceFile.cache.clear();
+#endif
+
+		sourceFile.log << "PreProcessing " << std::filesystem::relative(sourceFile.path, sourcePath) << "..." << std::endl;
+		if (!PreProcess(sourcePath, sourceFile, fileNumber))
+		{
+			preProcessFailed = true;
+			continue;
+		}
+#ifdef ASSEMBLER_USE_BUILD_CACHE
+		WriteCachedSourceFile(sourcePath, cachePath, sourceFile, contentHash);
+#endif
+		FinishFileStats(sourceFile, fileStart);
+	}
+}
+
+//Everything From Gathering The Source Files To Writing The ROM, Run Once Or Once Per Change In Watch Mode
+//"warmCaches" Holds The Cache Files Of The Previous Build By Source File Path, And Is Only Filled When "keepCachesWarm" Is Set
+//Both Are Left Alone Without ASSEMBLER_USE_BUILD_CACHE, Since There Are No Cache Files To Keep
+//"includedFiles" Is Filled With Every File Pulled In By ~incbin, So Watch Mode Can Rebuild When One Of Them Changes
+static void BuildROM(const std::filesystem::path& sourcePath, uint64_t jobCount, [[maybe_unused]] std::unordered_map<std::string, std::string>& warmCaches, [[maybe_unused]] bool keepCachesWarm, std::vector<std::filesystem::path>& includedFiles)
+{
+	ResetBuildStats();
+
+#ifdef ASSEMBLER_WRITE_BIT_LISTING
+	s_ListingPath = sourcePath / "AssemblerInt";
+	std::filesystem::remove_all(s_ListingPath);
+	std::filesystem::create_directory(s_ListingPath);
+#endif
+
+#ifdef ASSEMBLER_USE_BUILD_CACHE
+	std::error_code cacheError;
+	std::filesystem::create_directory(sourcePath / ASSEMBLER_CACHE_DIRECTORY, cacheError);
+#endif
+
+	std::vector<SourceFileInfo> sourceFiles;
+	for (auto dirIterator = std::filesystem::recursive_directory_iterator(sourcePath); dirIterator != std::filesystem::recursive_directory_iterator(); dirIterator++)
+	{
+		const std::filesystem::directory_entry& dirEntry = *dirIterator;
+		if (dirEntry.is_directory())
+		{
+#ifdef ASSEMBLER_USE_BUILD_CACHE
+			if (dirEntry.path() == sourcePath / ASSEMBLER_CACHE_DIRECTORY)
+				dirIterator.disable_recursion_pending();
+#endif
+			continue;
+		}
+
+		if (dirEntry.path().extension().string() == ".asm")
+		{
+			sourceFiles.emplace_back();
+			sourceFiles.back().path = dirEntry.path();
+#ifdef ASSEMBLER_USE_BUILD_CACHE
+			auto warmCache = warmCaches.find(dirEntry.path().string());
+			if (warmCache != warmCaches.end())
+				sourceFiles.back().cache = std::move(warmCache->second);
 #endif
+		}
+		else
+		{
+			std::cout << "Ignoring " << std::filesystem::relative(dirEntry.path(), sourcePath) << " because it is not an assembly file..." << std::endl;
+		}
+	}
 
-		//ADD Rd, Byte2
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = destinationRegisterSymbols[0];
-		newSymbols[6] = destinationRegisterSymbols[1];
-		newSymbols[7] = destinationRegisterSymbols[2];
-		for (size_t k = 8; k < 16; k++)
-		{
-			if (address & (0x00800000 >> (k - 8)))
-				newSymbols[k] = ASSEMBLER_OUTPUT_SYMBOL_1;
-			else
-				newSymbols[k] = ASSEMBLER_OUTPUT_SYMBOL_0;
+	EndBuildStage("Directory Scan");
+
+	//PreProcess The Files On "jobCount" Threads, Each File Only Writes To Its Own SourceFileInfo
+	std::atomic<size_t> nextFileNumber = 0;
+	std::atomic<bool> preProcessFailed = false;
+	std::vector<std::thread> workers;
+	for (uint64_t i = 1; i < jobCount && i < sourceFiles.size(); i++)
+		workers.emplace_back(PreProcessWorker, std::cref(sourcePath), std::ref(sourceFiles), std::ref(nextFileNumber), std::ref(preProcessFailed));
+	PreProcessWorker(sourcePath, sourceFiles, nextFileNumber, preProcessFailed);
+	for (size_t i = 0; i < workers.size(); i++)
+		workers[i].join();
+	EndBuildStage("PreProcess");
+
+	includedFiles.clear();
+	for (const SourceFileInfo& sourceFile : sourceFiles)
+	{
+		for (const ByteSequenceInfo& byteSequence : sourceFile.byteSequenceMap)
+		{
+			if (!byteSequence.includedPath.empty())
+				includedFiles.push_back((sourcePath / byteSequence.includedPath).lexically_normal());
 		}
-		outputStream.write(newSymbols, 16);
+	}
+	std::sort(includedFiles.begin(), includedFiles.end());
+	includedFiles.erase(std::unique(includedFiles.begin(), includedFiles.end()), includedFiles.end());
 
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
+#ifdef ASSEMBLER_USE_BUILD_CACHE
+	warmCaches.clear();
+	if (keepCachesWarm)
+	{
+		for (size_t i = 0; i < sourceFiles.size(); i++)
+		{
+			if (!sourceFiles[i].cache.empty())
+				warmCaches[sourceFiles[i].path.string()] = std::move(sourceFiles[i].cache);
+		}
+	}
 #endif
 
-		//LSL Rd, Rd, #8
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[10] = destinationRegisterSymbols[0];
-		newSymbols[11] = destinationRegisterSymbols[1];
-		newSymbols[12] = destinationRegisterSymbols[2];
-		newSymbols[13] = destinationRegisterSymbols[0];
-		newSymbols[14] = destinationRegisterSymbols[1];
-		newSymbols[15] = destinationRegisterSymbols[2];
-		outputStream.write(newSymbols, 16);
+	AssembleSourceFiles(sourcePath, sourceFiles);
+}
 
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
+//PreProcesses One Source File Into An Object File, Which --link Later Turns Into The ROM Along With The Others
+static void CompileSourceFile(const std::filesystem::path& sourcePath, const std::filesystem::path& filePath, const std::filesystem::path& objectPath)
+{
+#ifdef ASSEMBLER_WRITE_BIT_LISTING
+	s_ListingPath = sourcePath / "AssemblerInt";
+	std::error_code listingError;
+	std::filesystem::create_directory(s_ListingPath, listingError);
 #endif
 
-		//ADD Rd, Byte3
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = destinationRegisterSymbols[0];
-		newSymbols[6] = destinationRegisterSymbols[1];
-		newSymbols[7] = destinationRegisterSymbols[2];
-		for (size_t k = 8; k < 16; k++)
-		{
-			if (address & (0x00008000 >> (k - 8)))
-				newSymbols[k] = ASSEMBLER_OUTPUT_SYMBOL_1;
-			else
-				newSymbols[k] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		}
-		outputStream.write(newSymbols, 16);
+	SourceFileInfo sourceFile;
+	sourceFile.path = filePath;
+	sourceFile.log << "PreProcessing " << std::filesystem::relative(filePath, sourcePath) << "..." << std::endl;
+	bool preProcessed = PreProcess(sourcePath, sourceFile, 0);
+	std::cout << sourceFile.log.str();
+	if (!preProcessed)
+		return;
 
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
+	if (!WriteFileAtomically(objectPath, WriteObject(sourcePath, sourceFile, HashSourceFile(filePath))))
+	{
+		std::cout << "Could not write " << objectPath << std::endl;
+		return;
+	}
+	std::cout << "Successfully Compiled " << objectPath << std::endl;
+}
 
-		//LSL Rd, Rd, #8
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[6] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[7] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[8] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[9] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[10] = destinationRegisterSymbols[0];
-		newSymbols[11] = destinationRegisterSymbols[1];
-		newSymbols[12] = destinationRegisterSymbols[2];
-		newSymbols[13] = destinationRegisterSymbols[0];
-		newSymbols[14] = destinationRegisterSymbols[1];
-		newSymbols[15] = destinationRegisterSymbols[2];
-		outputStream.write(newSymbols, 16);
+//Files Are Numbered In The Order Their Object Files Are Given, Just As If They Had Been Found In The Source Folder In That Order
+static void LinkObjectFiles(const std::filesystem::path& sourcePath, const std::vector<std::filesystem::path>& objectPaths)
+{
+	ResetBuildStats();
 
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
+#ifdef ASSEMBLER_USE_BUILD_CACHE
+	//Linking Reads No Cache Files, But Compressed Streams Are Still Cached So ~compress Sequences Are Not Compressed Again
+	std::error_code cacheError;
+	std::filesystem::create_directory(sourcePath / ASSEMBLER_CACHE_DIRECTORY, cacheError);
 #endif
 
-		//ADD Rd, Byte4
-		newSymbols[0] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[1] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[2] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[3] = ASSEMBLER_OUTPUT_SYMBOL_1;
-		newSymbols[4] = ASSEMBLER_OUTPUT_SYMBOL_0;
-		newSymbols[5] = destinationRegisterSymbols[0];
-		newSymbols[6] = destinationRegisterSymbols[1];
-		newSymbols[7] = destinationRegisterSymbols[2];
-		for (size_t k = 8; k < 16; k++)
-		{
-			if (address & (0x00000080 >> (k - 8)))
-				newSymbols[k] = ASSEMBLER_OUTPUT_SYMBOL_1;
-			else
-				newSymbols[k] = ASSEMBLER_OUTPUT_SYMBOL_0;
+	std::vector<SourceFileInfo> sourceFiles(objectPaths.size());
+	for (size_t i = 0; i < objectPaths.size(); i++)
+	{
+		SourceTextInfo objectText;
+		if (!LoadSourceText(objectPaths[i], objectText))
+		{
+			std::cout << "Could not open " << objectPaths[i] << std::endl;
+			return;
 		}
-		outputStream.write(newSymbols, 16);
 
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		outputStream.write(ASSEMBLER_OUTPUT_SYMBOL_END_OF_INSTRUCTION_STRING, 1);
-#endif
-		
+		ObjectReaderInfo reader = { objectText.text, objectText.size };
+		ObjectHeaderInfo header;
+		if (!ReadObjectHeader(reader, header) || !ReadObjectBody(reader, sourceFiles[i], i))
+		{
+			std::cout << "Error In Linking..." << std::endl;
+			std::cout << objectPaths[i] << " Is Not An Object File Written By This Version Of GBA_Assembler" << std::endl;
+			return;
+		}
+		sourceFiles[i].path = sourcePath / header.relativePath;
+		sourceFiles[i].joinPaths = std::move(header.joinPaths);
+		sourceFiles[i].log << "Linking " << objectPaths[i] << "..." << std::endl;
+		sourceFiles[i].stats.bytesRead = objectText.size;
+		sourceFiles[i].stats.instructions = sourceFiles[i].section.size();
+		sourceFiles[i].stats.labels = sourceFiles[i].labelMap.size();
 	}
-	outputStream.close();
+	EndBuildStage("Read Objects");
 
+	AssembleSourceFiles(sourcePath, sourceFiles);
+}
 
-	//Assemble
-	std::filesystem::path assembledBinaryPath = sourcePath / "MyGame.gba";
-	outputStream.open(assembledBinaryPath, std::ios::out | std::ios::binary);
+static double NanosecondsToMilliseconds(uint64_t nanoseconds)
+{
+	return (double)nanoseconds / 1000000.0;
+}
 
-	for (size_t i = 0; i < 192; i++)
-		outputStream << '\xff';
+static void PrintBuildStats()
+{
+	uint64_t totalNanoseconds = 0;
+	FileStatsInfo totals;
+	uint64_t amountCached = 0;
+	for (const FileStatsInfo& file : s_BuildStats.files)
+	{
+		totals.lines += file.lines;
+		totals.instructions += file.instructions;
+		totals.labels += file.labels;
+		totals.bytesRead += file.bytesRead;
+		totals.bytesWritten += file.bytesWritten;
+		amountCached += file.cached;
+	}
 
-	uint64_t addressOfEntryPoint = s_LabelMap[indexOfEntryPoint].instructionNumber;
-	addressOfEntryPoint *= 2;
-	addressOfEntryPoint += 0x08000000;
-	addressOfEntryPoint += 192;
-	addressOfEntryPoint += 28;
-	addressOfEntryPoint &= (UINT32_MAX - 1);
-	addressOfEntryPoint++;
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "Build Stats:" << std::endl;
+	for (const StageStatsInfo& stage : s_BuildStats.stages)
+	{
+		std::cout << "  " << std::left << std::setw(34) << stage.name << std::right << std::setw(12) << NanosecondsToMilliseconds(stage.nanoseconds) << " ms" << std::endl;
+		totalNanoseconds += stage.nanoseconds;
+	}
+	std::cout << "  " << std::left << std::setw(34) << "Total" << std::right << std::setw(12) << NanosecondsToMilliseconds(totalNanoseconds) << " ms" << std::endl;
+
+	std::cout << "  Files: " << s_BuildStats.files.size() << " (" << amountCached << " Cached), Lines PreProcessed: " << totals.lines << ", Instructions: " << totals.instructions << ", Labels: " << totals.labels << std::endl;
+	std::cout << "  Bytes Read: " << totals.bytesRead << ", Bytes Written To The Intermediate Directory: " << totals.bytesWritten << std::endl;
+	std::cout << "  Symbols: " << s_BuildStats.symbols << " In A Table Of " << s_BuildStats.symbolTableSlots << " Slots" << std::endl;
+	std::cout << "  Branches: " << s_BuildStats.branches << ", Veneers: " << s_BuildStats.veneers << ", MOV Addresses: " << s_BuildStats.movAddresses << ", Literal Pools: " << s_BuildStats.literalPools << std::endl;
+	std::cout << "  Byte Sequences: " << s_BuildStats.byteSequences << ", Pointer Sequences: " << s_BuildStats.ptrSequences << ", Alignment Padding: " << s_BuildStats.dataPaddingBytes << " Bytes, Included By ~incbin: " << s_BuildStats.includedBytes << " Bytes" << std::endl;
+	if (s_BuildStats.compressedSequences != 0)
+		std::cout << "  Compressed Byte Sequences: " << s_BuildStats.compressedSequences << " (" << s_BuildStats.compressionCacheHits << " Cached), " << s_BuildStats.uncompressedBytes << " Bytes Down To " << s_BuildStats.compressedBytes << std::endl;
+	if (s_BuildOptions.collectGarbage)
+		std::cout << "  Removed By --gc: " << s_BuildStats.removedLabels << " Labels (" << s_BuildStats.removedCodeBytes << " Bytes Of Code), " << s_BuildStats.removedByteSequences << " Byte Sequences, " << s_BuildStats.removedPtrSequences << " Pointer Sequences (" << s_BuildStats.removedDataBytes << " Bytes Of Data)" << std::endl;
+	if (s_BuildOptions.optimizePeephole)
+		std::cout << "  Peephole Rewrites: " << s_BuildStats.peepholeRewrites << ", Removing " << s_BuildStats.peepholeRemovedBytes << " Bytes Of Code" << std::endl;
+	if (s_BuildOptions.mergeData)
+		std::cout << "  Merged Byte Sequences: " << s_BuildStats.mergedByteSequences << " (" << s_BuildStats.mergedBytes << " Bytes)" << std::endl;
+	std::cout << "  ROM: " << s_BuildStats.romBytes << " Bytes, Of Which " << s_BuildStats.paddingBytes << " Are Padding" << std::endl;
+
+	std::vector<const FileStatsInfo*> slowestFiles;
+	for (const FileStatsInfo& file : s_BuildStats.files)
+		slowestFiles.push_back(&file);
+	std::sort(slowestFiles.begin(), slowestFiles.end(), [](const FileStatsInfo* a, const FileStatsInfo* b) { return a->nanoseconds > b->nanoseconds; });
+	if (slowestFiles.size() > ASSEMBLER_STATS_SLOWEST_FILES)
+		slowestFiles.resize(ASSEMBLER_STATS_SLOWEST_FILES);
+	if (!slowestFiles.empty())
+		std::cout << "  Slowest Files:" << std::endl;
+	for (const FileStatsInfo* file : slowestFiles)
+	{
+		std::cout << "    " << std::left << std::setw(32) << file->path << std::right << std::setw(12) << NanosecondsToMilliseconds(file->nanoseconds) << " ms";
+		std::cout << ", " << file->lines << " Lines, " << file->instructions << " Instructions, " << file->labels << " Labels" << (file->cached ? ", Cached" : "") << std::endl;
+	}
+	std::cout << std::defaultfloat << std::setprecision(6);
+}
 
-	char startInstructions[4];
+static void WriteJsonString(std::ostream& outputStream, std::string_view str)
+{
+	outputStream << '"';
+	for (char c : str)
+	{
+		if (c == '"' || c == '\\')
+			outputStream << '\\' << c;
+		else if ((unsigned char)c < 0x20)
+			outputStream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)c << std::dec << std::setfill(' ');
+		else
+			outputStream << c;
+	}
+	outputStream << '"';
+}
 
-	//MOV R12, #0x08000000
-	startInstructions[0] = (char)0b00000010;
-	startInstructions[1] = (char)0b11000011;
-	startInstructions[2] = (char)0b10100000;
-	startInstructions[3] = (char)0b11100011;
-	outputStream.write(startInstructions, 4);
+//Times Are Given In Nanoseconds So Dashboards Can Scale Them However They Like
+static void WriteBuildStatsJson(const std::filesystem::path& statsPath)
+{
+	std::fstream outputStream;
+	outputStream.open(statsPath, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!outputStream.is_open())
+	{
+		std::cout << "Could not write " << statsPath << std::endl;
+		return;
+	}
 
-	//ADD R12, R12, #205
-	startInstructions[0] = (char)0b11001101;
-	startInstructions[1] = (char)0b11000000;
-	startInstructions[2] = (char)0b10001100;
-	startInstructions[3] = (char)0b11100010;
-	outputStream.write(startInstructions, 4);
+	outputStream << "{\n  \"stages\": [";
+	for (size_t i = 0; i < s_BuildStats.stages.size(); i++)
+	{
+		outputStream << (i == 0 ? "\n" : ",\n") << "    { \"name\": ";
+		WriteJsonString(outputStream, s_BuildStats.stages[i].name);
+		outputStream << ", \"nanoseconds\": " << s_BuildStats.stages[i].nanoseconds << " }";
+	}
+	outputStream << "\n  ],\n  \"files\": [";
+	for (size_t i = 0; i < s_BuildStats.files.size(); i++)
+	{
+		const FileStatsInfo& file = s_BuildStats.files[i];
+		outputStream << (i == 0 ? "\n" : ",\n") << "    { \"path\": ";
+		WriteJsonString(outputStream, file.path);
+		outputStream << ", \"nanoseconds\": " << file.nanoseconds << ", \"cached\": " << (file.cached ? "true" : "false");
+		outputStream << ", \"lines\": " << file.lines << ", \"instructions\": " << file.instructions << ", \"labels\": " << file.labels;
+		outputStream << ", \"bytesRead\": " << file.bytesRead << ", \"bytesWritten\": " << file.bytesWritten << " }";
+	}
+	outputStream << "\n  ],\n";
+	outputStream << "  \"symbols\": " << s_BuildStats.symbols << ",\n";
+	outputStream << "  \"symbolTableSlots\": " << s_BuildStats.symbolTableSlots << ",\n";
+	outputStream << "  \"branches\": " << s_BuildStats.branches << ",\n";
+	outputStream << "  \"veneers\": " << s_BuildStats.veneers << ",\n";
+	outputStream << "  \"movAddresses\": " << s_BuildStats.movAddresses << ",\n";
+	outputStream << "  \"literalPools\": " << s_BuildStats.literalPools << ",\n";
+	outputStream << "  \"byteSequences\": " << s_BuildStats.byteSequences << ",\n";
+	outputStream << "  \"ptrSequences\": " << s_BuildStats.ptrSequences << ",\n";
+	outputStream << "  \"mergedByteSequences\": " << s_BuildStats.mergedByteSequences << ",\n";
+	outputStream << "  \"mergedBytes\": " << s_BuildStats.mergedBytes << ",\n";
+	outputStream << "  \"dataPaddingBytes\": " << s_BuildStats.dataPaddingBytes << ",\n";
+	outputStream << "  \"includedBytes\": " << s_BuildStats.includedBytes << ",\n";
+	outputStream << "  \"compressedSequences\": " << s_BuildStats.compressedSequences << ",\n";
+	outputStream << "  \"compressionCacheHits\": " << s_BuildStats.compressionCacheHits << ",\n";
+	outputStream << "  \"uncompressedBytes\": " << s_BuildStats.uncompressedBytes << ",\n";
+	outputStream << "  \"compressedBytes\": " << s_BuildStats.compressedBytes << ",\n";
+	outputStream << "  \"removedLabels\": " << s_BuildStats.removedLabels << ",\n";
+	outputStream << "  \"removedCodeBytes\": " << s_BuildStats.removedCodeBytes << ",\n";
+	outputStream << "  \"removedByteSequences\": " << s_BuildStats.removedByteSequences << ",\n";
+	outputStream << "  \"removedPtrSequences\": " << s_BuildStats.removedPtrSequences << ",\n";
+	outputStream << "  \"removedDataBytes\": " << s_BuildStats.removedDataBytes << ",\n";
+	outputStream << "  \"peepholeRewrites\": " << s_BuildStats.peepholeRewrites << ",\n";
+	outputStream << "  \"peepholeRemovedBytes\": " << s_BuildStats.peepholeRemovedBytes << ",\n";
+	outputStream << "  \"romBytes\": " << s_BuildStats.romBytes << ",\n";
+	outputStream << "  \"paddingBytes\": " << s_BuildStats.paddingBytes << "\n}\n";
+}
 
-	//BX R12
-	startInstructions[0] = (char)0b00011100;
-	startInstructions[1] = (char)0b11111111;
-	startInstructions[2] = (char)0b00101111;
-	startInstructions[3] = (char)0b11100001;
-	outputStream.write(startInstructions, 4);
+static void ReportBuildStats(bool printStats, const std::filesystem::path& statsJsonPath)
+{
+	if (printStats)
+		PrintBuildStats();
+	if (!statsJsonPath.empty())
+		WriteBuildStatsJson(statsJsonPath);
+}
 
-	//MOV R7, Byte1 & LSL R7, R7, #8
-	startInstructions[0] = (char)((addressOfEntryPoint & 0xFF000000) >> 24);
-	startInstructions[1] = (char)0b00100111;
-	startInstructions[2] = (char)0b00111111;
-	startInstructions[3] = (char)0b00000010;
-	outputStream.write(startInstructions, 4);
+//Modification Times Of Every Assembly File, Compared To Spot Changes When inotify Is Not Available
+static std::vector<std::pair<std::filesystem::path, std::filesystem::file_time_type>> TakeSourceSnapshot(const std::filesystem::path& sourcePath)
+{
+	std::vector<std::pair<std::filesystem::path, std::filesystem::file_time_type>> snapshot;
+	std::error_code snapshotError;
+	for (auto dirIterator = std::filesystem::recursive_directory_iterator(sourcePath, snapshotError); dirIterator != std::filesystem::recursive_directory_iterator(); dirIterator.increment(snapshotError))
+	{
+		if (snapshotError)
+			break;
+		if (dirIterator->is_directory() || dirIterator->path().extension().string() != ".asm")
+			continue;
+		snapshot.emplace_back(dirIterator->path(), dirIterator->last_write_time(snapshotError));
+	}
+	return snapshot;
+}
 
-	//ADD R7, Byte2 & LSL R7, R7, #8
-	startInstructions[0] = (char)((addressOfEntryPoint & 0x00FF0000) >> 16);
-	startInstructions[1] = (char)0b00110111;
-	startInstructions[2] = (char)0b00111111;
-	startInstructions[3] = (char)0b00000010;
-	outputStream.write(startInstructions, 4);
+//Modification Times Of The Files Included By ~incbin, Which Are Not Assembly Files And May Be Outside The Source Folder
+static std::vector<std::pair<std::filesystem::path, std::filesystem::file_time_type>> TakeIncludedSnapshot(const std::vector<std::filesystem::path>& includedFiles)
+{
+	std::vector<std::pair<std::filesystem::path, std::filesystem::file_time_type>> snapshot;
+	for (const std::filesystem::path& includedFile : includedFiles)
+	{
+		std::error_code snapshotError;
+		snapshot.emplace_back(includedFile, std::filesystem::last_write_time(includedFile, snapshotError));
+	}
+	return snapshot;
+}
 
-	//ADD R7, Byte3 & LSL R7, R7, #8
-	startInstructions[0] = (char)((addressOfEntryPoint & 0x0000FF00) >> 8);
-	startInstructions[1] = (char)0b00110111;
-	startInstructions[2] = (char)0b00111111;
-	startInstructions[3] = (char)0b00000010;
-	outputStream.write(startInstructions, 4);
+//Started Before The First Build, So Files Saved While A Build Is Running Still Cause Another One
+//"includedFiles" Is Refilled By Every Build, As Each One May Include Different Files
+struct SourceWatcherInfo
+{
+	std::filesystem::path sourcePath;
+	std::vector<std::pair<std::filesystem::path, std::filesystem::file_time_type>> snapshot;
+	std::vector<std::filesystem::path> includedFiles;
+	std::vector<std::pair<std::filesystem::path, std::filesystem::file_time_type>> includedSnapshot;
+#ifdef ASSEMBLER_WATCH_WITH_INOTIFY
+	int fileDescriptor = -1;
+	//The Watch On The Directory Of Each Included File Along With Its Name, So An Included File That Is Replaced Rather Than Written To Is Seen Too
+	std::vector<std::pair<int, std::string>> includedWatches;
+#endif
+};
 
-	//ADD R7, Byte4 & BX R7
-	startInstructions[0] = (char)(addressOfEntryPoint & 0x000000FF);
-	startInstructions[1] = (char)0b00110111;
-	startInstructions[2] = (char)0b00111000;
-	startInstructions[3] = (char)0b01000111;
-	outputStream.write(startInstructions, 4);
+#ifdef ASSEMBLER_WATCH_WITH_INOTIFY
+static const uint32_t s_WatchedSourceEvents = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE;
 
-	inputStream.open(combinedFilePath, std::ios::in | std::ios::binary);
-	char nextInstruction[ASSEMBLER_INSTRUCTION_CHAR_SIZE];
-	char instructionByte1 = 0;
-	char instructionByte2 = 0;
-	while (inputStream.read(nextInstruction, ASSEMBLER_INSTRUCTION_CHAR_SIZE))
+static void WatchSourceDirectories(SourceWatcherInfo& watcher)
+{
+	inotify_add_watch(watcher.fileDescriptor, watcher.sourcePath.c_str(), s_WatchedSourceEvents);
+	std::error_code watchError;
+	for (auto dirIterator = std::filesystem::recursive_directory_iterator(watcher.sourcePath, watchError); dirIterator != std::filesystem::recursive_directory_iterator(); dirIterator.increment(watchError))
 	{
-		size_t i = 0;
-		for (; i < 8; i++)
+		if (watchError)
+			break;
+		if (!dirIterator->is_directory())
+			continue;
+#ifdef ASSEMBLER_USE_BUILD_CACHE
+		//The Cache Is Rewritten By Every Build, Watching It Would Start Another One
+		if (dirIterator->path() == watcher.sourcePath / ASSEMBLER_CACHE_DIRECTORY)
 		{
-			if (nextInstruction[i] == ASSEMBLER_OUTPUT_SYMBOL_1)
-				instructionByte1 += (1 << (7 - i));
-			else if (nextInstruction[i] != ASSEMBLER_OUTPUT_SYMBOL_0)
-			{
-				std::cout << "Error In Assembling..." << std::endl;
-				std::cout << "An Instruction Was Not Recorded Correctly" << std::endl;
-				return false;
-			}
+			dirIterator.disable_recursion_pending();
+			continue;
 		}
+#endif
+		inotify_add_watch(watcher.fileDescriptor, dirIterator->path().c_str(), s_WatchedSourceEvents);
+	}
+}
+
+//A Directory Already Being Watched Gives Back The Same Watch, So Included Files Inside The Source Folder Share Its Watches
+static void WatchIncludedFiles(SourceWatcherInfo& watcher)
+{
+	watcher.includedWatches.clear();
+	for (const std::filesystem::path& includedFile : watcher.includedFiles)
+	{
+		int watchDescriptor = inotify_add_watch(watcher.fileDescriptor, includedFile.parent_path().c_str(), s_WatchedSourceEvents);
+		if (watchDescriptor != -1)
+			watcher.includedWatches.emplace_back(watchDescriptor, includedFile.filename().string());
+	}
+}
+
+//Reads Every Queued Event, Returns True If Any Of Them Was For An Assembly File, A File Included By ~incbin Or A Directory
+static bool ReadSourceEvents(SourceWatcherInfo& watcher)
+{
+	alignas(inotify_event) char events[4096];
+	bool sourceChanged = false;
+	ssize_t amountRead = read(watcher.fileDescriptor, events, sizeof(events));
+	for (ssize_t position = 0; position < amountRead;)
+	{
+		const inotify_event* event = (const inotify_event*)(events + position);
+		position += sizeof(inotify_event) + event->len;
 
-		for (; i < 16; i++)
+#ifdef ASSEMBLER_USE_BUILD_CACHE
+		if (event->len != 0 && std::string_view(event->name) == ASSEMBLER_CACHE_DIRECTORY)
+			continue;
+#endif
+		if (event->mask & IN_ISDIR)
 		{
-			if (nextInstruction[i] == ASSEMBLER_OUTPUT_SYMBOL_1)
-				instructionByte2 += (1 << (15 - i));
-			else if (nextInstruction[i] != ASSEMBLER_OUTPUT_SYMBOL_0)
-			{
-				std::cout << "Error In Assembling..." << std::endl;
-				std::cout << "An Instruction Was Not Recorded Correctly" << std::endl;
-				return false;
-			}
+			WatchSourceDirectories(watcher);
+			sourceChanged = true;
 		}
-
-#ifdef ASSEMBLER_CONFIG_DEBUG
-		if (nextInstruction[i] != '\n')
+		else if (event->len != 0 && std::filesystem::path(event->name).extension().string() == ".asm")
 		{
-			std::cout << "Error In Assembling..." << std::endl;
-			std::cout << "An Instruction Was Not Recorded Correctly" << std::endl;
-			return false;
+			sourceChanged = true;
+		}
+		else if (event->len != 0 && std::find(watcher.includedWatches.begin(), watcher.includedWatches.end(), std::make_pair(event->wd, std::string(event->name))) != watcher.includedWatches.end())
+		{
+			sourceChanged = true;
 		}
+	}
+	return sourceChanged;
+}
 #endif
 
-		outputStream.write(&instructionByte2, 1);
-		outputStream.write(&instructionByte1, 1);
-
-		instructionByte1 = 0;
-		instructionByte2 = 0;
+static void StartWatchingSourceFiles(SourceWatcherInfo& watcher, const std::filesystem::path& sourcePath)
+{
+	watcher.sourcePath = sourcePath;
+#ifdef ASSEMBLER_WATCH_WITH_INOTIFY
+	watcher.fileDescriptor = inotify_init1(IN_CLOEXEC);
+	if (watcher.fileDescriptor != -1)
+	{
+		WatchSourceDirectories(watcher);
+		return;
 	}
-	inputStream.close();
-
-	for (size_t i = 0; i < s_ByteSequenceMap.size(); i++)
-		outputStream.write(s_ByteSequenceMap[i].bytes.data(), s_ByteSequenceMap[i].bytes.size());
-
-	for (size_t i = 0; i < s_PtrSequenceMap.size(); i++)
-		outputStream.write(s_PtrSequenceMap[i].bytes.data(), s_PtrSequenceMap[i].bytes.size());
-
-	outputStream.close();
-
-	//Create Header
-	outputStream.open(assembledBinaryPath, std::ios::in | std::ios::out | std::ios::binary);
-
-	outputStream << '\x2E' << '\x00' << '\x00' << '\xEA';
+#endif
+	watcher.snapshot = TakeSourceSnapshot(sourcePath);
+}
 
-	outputStream.close();
+static void WaitForSourceChange(SourceWatcherInfo& watcher)
+{
+#ifdef ASSEMBLER_WATCH_WITH_INOTIFY
+	if (watcher.fileDescriptor != -1)
+	{
+		WatchIncludedFiles(watcher);
+		pollfd watchedFile = { watcher.fileDescriptor, POLLIN, 0 };
+		while (!(poll(&watchedFile, 1, -1) > 0 && ReadSourceEvents(watcher)))
+			continue;
+		while (poll(&watchedFile, 1, ASSEMBLER_WATCH_SETTLE_MILLISECONDS) > 0)
+			ReadSourceEvents(watcher);
+		return;
+	}
+#endif
 
+	//Files Included For The First Time By The Last Build Are Compared From Now On, The Rest Keep Their Time From Before It
+	std::vector<std::pair<std::filesystem::path, std::filesystem::file_time_type>> includedSnapshot = TakeIncludedSnapshot(watcher.includedFiles);
+	for (std::pair<std::filesystem::path, std::filesystem::file_time_type>& includedFile : includedSnapshot)
+	{
+		for (const std::pair<std::filesystem::path, std::filesystem::file_time_type>& previousIncludedFile : watcher.includedSnapshot)
+		{
+			if (previousIncludedFile.first == includedFile.first)
+				includedFile.second = previousIncludedFile.second;
+		}
+	}
+	watcher.includedSnapshot = std::move(includedSnapshot);
 
-	std::cout << "Successfully Assembled " << "MyGame.gba" << std::endl;
-	return true;
+	std::vector<std::pair<std::filesystem::path, std::filesystem::file_time_type>> snapshot = TakeSourceSnapshot(watcher.sourcePath);
+	includedSnapshot = TakeIncludedSnapshot(watcher.includedFiles);
+	while (snapshot == watcher.snapshot && includedSnapshot == watcher.includedSnapshot)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(ASSEMBLER_WATCH_POLL_MILLISECONDS));
+		snapshot = TakeSourceSnapshot(watcher.sourcePath);
+		includedSnapshot = TakeIncludedSnapshot(watcher.includedFiles);
+	}
+	do
+	{
+		watcher.snapshot = std::move(snapshot);
+		watcher.includedSnapshot = std::move(includedSnapshot);
+		std::this_thread::sleep_for(std::chrono::milliseconds(ASSEMBLER_WATCH_SETTLE_MILLISECONDS));
+		snapshot = TakeSourceSnapshot(watcher.sourcePath);
+		includedSnapshot = TakeIncludedSnapshot(watcher.includedFiles);
+	} while (snapshot != watcher.snapshot || includedSnapshot != watcher.includedSnapshot);
 }
 
 int main(int argc, char** argv)
@@ -4287,81 +5785,138 @@ int main(int argc, char** argv)
 		return 0;
 	}
 
-	if (argc >= 3)
-	{
-		std::cout << "GBA_Assembler only takes one arguement and that is the folder where all the source files are kept!" << std::endl;
-		return 0;
-	}
-
-	std::filesystem::path sourcePath = argv[1];
-#endif
-
-#ifdef ASSEMBLER_CONFIG_DEBUG
-	std::filesystem::path intermediatePath = sourcePath / "AssemblerInt";
-	std::filesystem::remove_all(intermediatePath);
-#endif
-
-#ifdef ASSEMBLER_CONFIG_RELEASE
-	std::filesystem::path intermediatePath = sourcePath;
-	while (std::filesystem::exists(intermediatePath))
-		intermediatePath /= "0";
+	std::filesystem::path sourcePath;
 #endif
 
-	std::filesystem::create_directory(intermediatePath);
-	size_t currentFileNumber = 0;
-	bool preprocessedAll = false;
-	for (const auto& dirEntry : std::filesystem::recursive_directory_iterator(sourcePath))
+	bool watch = false;
+	bool printStats = false;
+	std::filesystem::path statsJsonPath;
+	std::filesystem::path compileFilePath;
+	std::filesystem::path objectPath;
+	std::vector<std::filesystem::path> linkObjectPaths;
+	for (int i = 1; i < argc; i++)
 	{
-		if (dirEntry.is_directory())
-			continue;
-
-		std::filesystem::path relativePath = std::filesystem::relative(dirEntry.path(), sourcePath);
-		if (dirEntry.path().extension().string() == ".asm")
+		std::string argument = argv[i];
+		if (argument == "--watch")
 		{
-			std::cout << "PreProcessing " << relativePath << "..." << std::endl;
-			preprocessedAll = PreProcess(sourcePath, dirEntry.path(), currentFileNumber, intermediatePath);
-			currentFileNumber++;
-			if (!preprocessedAll)
-				break;
+			watch = true;
 		}
-		else
+		else if (argument == "--stats")
 		{
-			std::cout << "Ignoring " << relativePath << " because it is not an assembly file..." << std::endl;
+			printStats = true;
 		}
-	}
-	if (preprocessedAll)
-	{
-		std::cout << "Assembling..." << std::endl;
-		if (Assemble(sourcePath, intermediatePath))
+		else if (argument == "--merge-data")
 		{
-			size_t binaryFileSize = std::filesystem::file_size(sourcePath / "MyGame.gba");
-			size_t appendedFileSize = 1;
-			while (binaryFileSize > appendedFileSize)
-				appendedFileSize <<= 1;
-
-			appendedFileSize -= binaryFileSize;
-			std::fstream outputStream;
-			outputStream.open(sourcePath / "MyGame.gba", std::ios::out | std::ios::binary | std::ios::app);
-			for (size_t i = 0; i < appendedFileSize; i++)
-				outputStream << '\xFF';
-			outputStream.close();
+			s_BuildOptions.mergeData = true;
+		}
+		else if (argument == "--gc")
+		{
+			s_BuildOptions.collectGarbage = true;
+		}
+		else if (argument == "--peephole")
+		{
+			s_BuildOptions.optimizePeephole = true;
+		}
+		else if (argument == "--stats-json")
+		{
+			i++;
+			if (i >= argc)
+			{
+				std::cout << "The --stats-json Option Must Be Followed By The File To Write The Stats To!" << std::endl;
+				return 0;
+			}
+			statsJsonPath = argv[i];
+		}
+		else if (argument == "--compile")
+		{
+			if (i + 2 >= argc || std::filesystem::path(argv[i + 1]).extension().string() != ".asm")
+			{
+				std::cout << "The --compile Option Must Be Followed By The Assembly File To Compile And The Object File To Write!" << std::endl;
+				return 0;
+			}
+			compileFilePath = argv[i + 1];
+			objectPath = argv[i + 2];
+			i += 2;
+		}
+		else if (argument == "--link")
+		{
+			//Every Argument After --link Up To The Next Option Is An Object File
+			for (i++; i < argc && argv[i][0] != '-'; i++)
+				linkObjectPaths.push_back(argv[i]);
+			i--;
+			if (linkObjectPaths.empty())
+			{
+				std::cout << "The --link Option Must Be Followed By The Object Files To Link!" << std::endl;
+				return 0;
+			}
+		}
+		else if (argument == "-j")
+		{
+			i++;
+			int requestedJobCount = 0;
+			if (i < argc)
+				requestedJobCount = StringToDecimalInt(argv[i]);
+			if (i >= argc || !s_SuccessfulIntConversion || requestedJobCount < 1)
+			{
+				std::cout << "The -j Option Must Be Followed By The Number Of Files To PreProcess At Once!" << std::endl;
+				return 0;
+			}
+			s_BuildOptions.jobCount = requestedJobCount;
+		}
+#ifdef ASSEMBLER_CONFIG_RELEASE
+		else if (sourcePath.empty())
+		{
+			sourcePath = argument;
+		}
+#endif
+		else
+		{
+			std::cout << "GBA_Assembler only takes the folder where all the source files are kept, optionally followed by -j N, --watch, --merge-data, --gc, --peephole, --stats, --stats-json FILE, --compile FILE OBJECT, or --link OBJECTS!" << std::endl;
+			return 0;
 		}
 	}
+
 #ifdef ASSEMBLER_CONFIG_RELEASE
-	std::filesystem::remove_all(intermediatePath);
+	if (sourcePath.empty())
+	{
+		std::cout << "GBA_Assembler needs the folder where all the source files are kept!" << std::endl;
+		return 0;
+	}
 #endif
 
-	s_LabelMap.clear();
-	s_BranchMap.clear();
-	s_ByteSequenceMap.clear();
-	s_PtrSequenceMap.clear();
-	s_MovAddressMap.clear();
-	s_JoinMap.clear();
-	s_LabelMap.shrink_to_fit();
-	s_BranchMap.shrink_to_fit();
-	s_ByteSequenceMap.shrink_to_fit();
-	s_PtrSequenceMap.shrink_to_fit();
-	s_MovAddressMap.shrink_to_fit();
-	s_JoinMap.shrink_to_fit();
+	//The ROM Is Written To The Source Folder When Linking, And Object Files Record Their Paths Relative To It
+	if (!compileFilePath.empty())
+	{
+		CompileSourceFile(sourcePath, compileFilePath, objectPath);
+		return 0;
+	}
+	if (!linkObjectPaths.empty())
+	{
+		LinkObjectFiles(sourcePath, linkObjectPaths);
+		ReportBuildStats(printStats, statsJsonPath);
+		return 0;
+	}
+
+	std::unordered_map<std::string, std::string> warmCaches;
+	if (!watch)
+	{
+		std::vector<std::filesystem::path> includedFiles;
+		BuildROM(sourcePath, s_BuildOptions.jobCount, warmCaches, false, includedFiles);
+		ReportBuildStats(printStats, statsJsonPath);
+		return 0;
+	}
+
+	//Watch Mode Only Ends When The Process Is Stopped
+	SourceWatcherInfo watcher;
+	StartWatchingSourceFiles(watcher, sourcePath);
+	while (true)
+	{
+		std::chrono::steady_clock::time_point buildStart = std::chrono::steady_clock::now();
+		BuildROM(sourcePath, s_BuildOptions.jobCount, warmCaches, true, watcher.includedFiles);
+		ReportBuildStats(printStats, statsJsonPath);
+		std::chrono::milliseconds buildTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - buildStart);
+		std::cout << "Built In " << buildTime.count() << "ms, Watching " << sourcePath << " For Changes (Press Ctrl+C To Stop)..." << std::endl;
+		WaitForSourceChange(watcher);
+	}
 	return 0;
 }
\ No newline at end of file
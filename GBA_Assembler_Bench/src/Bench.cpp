@@ -0,0 +1,500 @@
+#include <iostream>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <sstream>
+#include <chrono>
+#include <iomanip>
+#include <random>
+#include <algorithm>
+
+//Sizes Are In Instructions, Swept From Smallest To Largest Unless --sizes Is Given
+#define BENCH_DEFAULT_SIZES { 1000, 10000, 100000, 1000000, 10000000 }
+#define BENCH_DEFAULT_RUNS 3
+#define BENCH_DEFAULT_WORK_DIRECTORY "BenchWork"
+
+//Conditional Branches Only Go To One Of This Many Of The Most Recent Labels, So Most Stay In Short Range
+#define BENCH_BRANCH_LABEL_WINDOW 8
+//Every File Ends With This Many Functions For CALLs To Land On
+#define BENCH_FUNCTIONS_PER_FILE 4
+//Pointer Sequences Each Point At This Many Byte Sequences
+#define BENCH_POINTERS_PER_SEQUENCE 4
+
+//Everything That Shapes The Generated Project, All Ratios Are Per Instruction
+struct BenchConfigInfo
+{
+	std::vector<uint64_t> sizes = BENCH_DEFAULT_SIZES;
+	uint64_t files = 16;
+	double labelDensity = 0.05;
+	double branchRatio = 0.05;
+	double callRatio = 0.02;
+	double movAddressRatio = 0.02;
+	uint64_t joinDepth = 0;
+	uint64_t sequenceBytes = 4096;
+	uint64_t runs = BENCH_DEFAULT_RUNS;
+	uint64_t seed = 1;
+	std::filesystem::path assemblerPath;
+	std::filesystem::path workPath = BENCH_DEFAULT_WORK_DIRECTORY;
+	std::filesystem::path csvPath;
+	bool keepSources = false;
+};
+
+struct StageTimeInfo
+{
+	std::string name;
+	uint64_t nanoseconds;
+};
+
+struct BenchResultInfo
+{
+	uint64_t size;
+	uint64_t generatedInstructions;
+	uint64_t sourceBytes;
+	double coldMilliseconds;
+	double warmMilliseconds;
+	std::vector<StageTimeInfo> stages;
+	bool succeeded;
+};
+
+static bool ParseUnsigned(const char* str, uint64_t& value)
+{
+	char* end = nullptr;
+	value = std::strtoull(str, &end, 10);
+	return end != str && *end == '\0';
+}
+
+static bool ParseRatio(const char* str, double& value)
+{
+	char* end = nullptr;
+	value = std::strtod(str, &end);
+	return end != str && *end == '\0' && value >= 0.0 && value <= 1.0;
+}
+
+static bool ParseSizes(const std::string& str, std::vector<uint64_t>& sizes)
+{
+	sizes.clear();
+	std::stringstream sizeStream(str);
+	std::string size;
+	while (std::getline(sizeStream, size, ','))
+	{
+		uint64_t value = 0;
+		if (!ParseUnsigned(size.c_str(), value) || value == 0)
+			return false;
+		sizes.push_back(value);
+	}
+	return !sizes.empty();
+}
+
+//Names Are Built From The File Number So Every File Can Refer To Every Other File's Functions And Byte Sequences Up Front
+static std::string FileName(uint64_t file)
+{
+	return "f" + std::to_string(file) + ".asm";
+}
+
+static std::string FunctionLabel(uint64_t file, uint64_t function)
+{
+	return "F" + std::to_string(file) + "_FN" + std::to_string(function);
+}
+
+static std::string ByteSequenceLabel(uint64_t file, uint64_t sequence)
+{
+	return "F" + std::to_string(file) + "_B" + std::to_string(sequence);
+}
+
+//Plain ALU Instructions That Take One Halfword Each, Picked At Random To Fill The Space Between Everything Else
+static const char* s_FillerInstructions[] =
+{
+	"ADD R0, #1",
+	"SUB R1, #3",
+	"MOV R2, #200",
+	"CMP R3, #17",
+	"ADD R4, R0, R1",
+	"SUB R5, R2, #2",
+	"AND R0, R1",
+	"ORR R2, R3",
+	"XOR R4, R5",
+	"MUL R1, R2",
+	"NEG R3, R4",
+	"LSL R0, R1, #4",
+	"LSR R2, R3, #1",
+	"LDRH R3, R2, #0",
+	"STRH R2, R1, #1",
+	"TST R1, R1"
+};
+
+static const char* s_ConditionalBranches[] = { "BEQ", "BNE", "BCS", "BCC", "BMI", "BPL", "BHI", "BLS", "BGE", "BLT", "BGT", "BLE" };
+
+//Writes "config.files" Source Files Holding About "size" Instructions Altogether, Returns How Many Lines Of Instructions It Wrote
+static uint64_t GenerateProject(const BenchConfigInfo& config, uint64_t size, const std::filesystem::path& projectPath, uint64_t& sourceBytes)
+{
+	std::mt19937_64 random(config.seed ^ size);
+	std::uniform_real_distribution<double> chance(0.0, 1.0);
+	uint64_t files = std::max<uint64_t>(1, std::min(config.files, size / 16 + 1));
+	uint64_t instructionsPerFile = std::max<uint64_t>(1, size / files);
+	uint64_t sequencesPerFile = std::max<uint64_t>(1, config.sequenceBytes / files / 64);
+	uint64_t bytesPerSequence = std::max<uint64_t>(1, config.sequenceBytes / files / sequencesPerFile);
+	uint64_t generatedInstructions = 0;
+	sourceBytes = 0;
+
+	std::filesystem::remove_all(projectPath);
+	std::filesystem::create_directories(projectPath);
+
+	for (uint64_t file = 0; file < files; file++)
+	{
+		std::string source;
+		source.reserve(instructionsPerFile * 24);
+
+		//Each File Joins The Next One, Down To "joinDepth" Files Deep
+		if (file < config.joinDepth && file + 1 < files)
+			source += "~join \"" + FileName(file + 1) + "\"\n";
+
+		if (file == 0)
+			source += "ENTRY:\tMOV R0, #0\n";
+
+		std::vector<std::string> labels;
+		uint64_t pendingLabel = 0;
+		for (uint64_t i = 0; i < instructionsPerFile; i++)
+		{
+			std::string line = "\t\t";
+			if (chance(random) < config.labelDensity)
+			{
+				labels.push_back("F" + std::to_string(file) + "_L" + std::to_string(labels.size()));
+				line = labels.back() + ":\t";
+			}
+
+			double kind = chance(random);
+			if (kind < config.branchRatio)
+			{
+				//Either Back To A Recent Label Or Forward To The Next One, Which Is Always Written Before The File Ends
+				if (!labels.empty() && chance(random) < 0.5)
+				{
+					uint64_t window = std::min<uint64_t>(labels.size(), BENCH_BRANCH_LABEL_WINDOW);
+					line += std::string(s_ConditionalBranches[random() % std::size(s_ConditionalBranches)]) + " " + labels[labels.size() - 1 - random() % window];
+				}
+				else
+				{
+					line += std::string(s_ConditionalBranches[random() % std::size(s_ConditionalBranches)]) + " F" + std::to_string(file) + "_L" + std::to_string(labels.size());
+					pendingLabel = labels.size() + 1;
+				}
+			}
+			else if (kind < config.branchRatio + config.callRatio)
+			{
+				line += "CALL " + FunctionLabel(random() % files, random() % BENCH_FUNCTIONS_PER_FILE);
+			}
+			else if (kind < config.branchRatio + config.callRatio + config.movAddressRatio)
+			{
+				//Half To Code, Half To Data, So Both Literal Pools And Sequence Addresses Get Used
+				if (chance(random) < 0.5)
+					line += "MOVA R2, &" + FunctionLabel(random() % files, random() % BENCH_FUNCTIONS_PER_FILE);
+				else
+					line += "MOVA R2, &" + ByteSequenceLabel(random() % files, random() % sequencesPerFile);
+			}
+			else
+			{
+				line += s_FillerInstructions[random() % std::size(s_FillerInstructions)];
+			}
+			source += line + "\n";
+			generatedInstructions++;
+		}
+
+		//Close Off Forward Branches And Make Sure Execution Never Runs Into The Functions
+		while (labels.size() < pendingLabel)
+		{
+			labels.push_back("F" + std::to_string(file) + "_L" + std::to_string(labels.size()));
+			source += labels.back() + ":\tADD R0, #1\n";
+			generatedInstructions++;
+		}
+		source += "F" + std::to_string(file) + "_END:\tB F" + std::to_string(file) + "_END\n";
+		generatedInstructions++;
+
+		for (uint64_t function = 0; function < BENCH_FUNCTIONS_PER_FILE; function++)
+		{
+			source += FunctionLabel(file, function) + ":\tADD R0, #2\n\t\tRETURN\n";
+			generatedInstructions += 2;
+		}
+
+		for (uint64_t sequence = 0; sequence < sequencesPerFile; sequence++)
+		{
+			source += ByteSequenceLabel(file, sequence) + ": {";
+			for (uint64_t b = 0; b < bytesPerSequence; b++)
+			{
+				static const char hexDigits[] = "0123456789ABCDEF";
+				uint8_t value = (uint8_t)random();
+				source += (b == 0 ? "" : ", ");
+				source += hexDigits[value >> 4];
+				source += hexDigits[value & 0xF];
+			}
+			source += "}\n";
+		}
+
+		for (uint64_t sequence = 0; sequence + BENCH_POINTERS_PER_SEQUENCE <= sequencesPerFile; sequence += BENCH_POINTERS_PER_SEQUENCE)
+		{
+			source += "F" + std::to_string(file) + "_P" + std::to_string(sequence) + ": [";
+			for (uint64_t p = 0; p < BENCH_POINTERS_PER_SEQUENCE; p++)
+				source += (p == 0 ? "" : ", ") + ByteSequenceLabel(random() % files, random() % sequencesPerFile);
+			source += "]\n";
+		}
+
+		std::fstream outputStream;
+		outputStream.open(projectPath / FileName(file), std::ios::out | std::ios::binary | std::ios::trunc);
+		outputStream.write(source.data(), source.size());
+		outputStream.close();
+		sourceBytes += source.size();
+	}
+	return generatedInstructions;
+}
+
+//Reads The "stages" Array Written By --stats-json, The Format Is Known So A Full JSON Parser Is Not Needed
+static std::vector<StageTimeInfo> ReadStageTimes(const std::filesystem::path& statsPath)
+{
+	std::vector<StageTimeInfo> stages;
+	std::ifstream inputStream(statsPath, std::ios::in | std::ios::binary);
+	if (!inputStream.is_open())
+		return stages;
+	std::string json((std::istreambuf_iterator<char>(inputStream)), std::istreambuf_iterator<char>());
+
+	size_t position = json.find("\"stages\"");
+	size_t stagesEnd = json.find(']', position);
+	while (position != std::string::npos)
+	{
+		position = json.find("\"name\": \"", position);
+		if (position == std::string::npos || position > stagesEnd)
+			break;
+		position += 9;
+		size_t nameEnd = json.find('"', position);
+		std::string name = json.substr(position, nameEnd - position);
+		position = json.find("\"nanoseconds\": ", nameEnd);
+		if (position == std::string::npos)
+			break;
+		position += 15;
+		stages.push_back({ name, std::strtoull(json.c_str() + position, nullptr, 10) });
+	}
+	return stages;
+}
+
+//Runs The Assembler Once On "projectPath", Returns The Wall Time In Milliseconds Or A Negative Number If It Did Not Assemble
+static double RunAssembler(const BenchConfigInfo& config, const std::filesystem::path& projectPath, const std::filesystem::path& statsPath)
+{
+	std::filesystem::path logPath = projectPath.parent_path() / "assembler.log";
+	std::filesystem::remove(projectPath / "MyGame.gba");
+	std::string command = "\"" + config.assemblerPath.string() + "\" \"" + projectPath.string() + "\" --stats-json \"" + statsPath.string() + "\" > \"" + logPath.string() + "\" 2>&1";
+#ifdef _WIN32
+	//cmd Strips The First And Last Quote Of The Whole Command
+	command = "\"" + command + "\"";
+#endif
+
+	std::chrono::steady_clock::time_point runStart = std::chrono::steady_clock::now();
+	std::system(command.c_str());
+	double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - runStart).count();
+
+	if (!std::filesystem::exists(projectPath / "MyGame.gba"))
+	{
+		std::cout << "The Assembler Did Not Assemble " << projectPath << ", See " << logPath << std::endl;
+		return -1.0;
+	}
+	return milliseconds;
+}
+
+//Cold Runs Start Without A Build Cache, The Best Of "config.runs" Is Kept So Noise From Other Processes Only Ever Adds Time
+static BenchResultInfo BenchSize(const BenchConfigInfo& config, uint64_t size)
+{
+	BenchResultInfo result = {};
+	result.size = size;
+	std::filesystem::path projectPath = config.workPath / std::to_string(size) / "src";
+	std::filesystem::path statsPath = config.workPath / std::to_string(size) / "stats.json";
+
+	result.generatedInstructions = GenerateProject(config, size, projectPath, result.sourceBytes);
+
+	result.coldMilliseconds = -1.0;
+	for (uint64_t run = 0; run < config.runs; run++)
+	{
+		std::filesystem::remove_all(projectPath / "AssemblerCache");
+		double milliseconds = RunAssembler(config, projectPath, statsPath);
+		if (milliseconds < 0.0)
+			return result;
+		if (result.coldMilliseconds < 0.0 || milliseconds < result.coldMilliseconds)
+		{
+			result.coldMilliseconds = milliseconds;
+			result.stages = ReadStageTimes(statsPath);
+		}
+	}
+
+	//The Last Cold Run Left A Full Cache Behind
+	result.warmMilliseconds = RunAssembler(config, projectPath, statsPath);
+	result.succeeded = result.warmMilliseconds >= 0.0;
+
+	if (!config.keepSources)
+		std::filesystem::remove_all(config.workPath / std::to_string(size));
+	return result;
+}
+
+static void PrintResult(const BenchResultInfo& result)
+{
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "Size " << result.size << ": " << result.generatedInstructions << " Lines Of Instructions, " << result.sourceBytes << " Bytes Of Source" << std::endl;
+	if (!result.succeeded)
+	{
+		std::cout << "  Failed" << std::endl;
+		return;
+	}
+	std::cout << "  " << std::left << std::setw(34) << "End To End (Cold)" << std::right << std::setw(12) << result.coldMilliseconds << " ms" << std::endl;
+	std::cout << "  " << std::left << std::setw(34) << "End To End (Cached)" << std::right << std::setw(12) << result.warmMilliseconds << " ms" << std::endl;
+	for (const StageTimeInfo& stage : result.stages)
+		std::cout << "    " << std::left << std::setw(32) << stage.name << std::right << std::setw(12) << (double)stage.nanoseconds / 1000000.0 << " ms" << std::endl;
+	std::cout << "  " << std::left << std::setw(34) << "Per 1000 Instructions (Cold)" << std::right << std::setw(12) << result.coldMilliseconds * 1000.0 / (double)result.generatedInstructions << " ms" << std::endl;
+}
+
+//One Row Per Size And One Column Per Stage, Ready For A Spreadsheet Or Plotting Script
+static void WriteCsv(const std::filesystem::path& csvPath, const std::vector<BenchResultInfo>& results)
+{
+	std::fstream outputStream;
+	outputStream.open(csvPath, std::ios::out | std::ios::trunc);
+	if (!outputStream.is_open())
+	{
+		std::cout << "Could not write " << csvPath << std::endl;
+		return;
+	}
+
+	std::vector<std::string> stageNames;
+	for (const BenchResultInfo& result : results)
+	{
+		for (const StageTimeInfo& stage : result.stages)
+		{
+			if (std::find(stageNames.begin(), stageNames.end(), stage.name) == stageNames.end())
+				stageNames.push_back(stage.name);
+		}
+	}
+
+	outputStream << "size,instructions,sourceBytes,coldMs,cachedMs";
+	for (const std::string& stageName : stageNames)
+		outputStream << "," << stageName << " (ms)";
+	outputStream << "\n" << std::fixed << std::setprecision(3);
+
+	for (const BenchResultInfo& result : results)
+	{
+		if (!result.succeeded)
+			continue;
+		outputStream << result.size << "," << result.generatedInstructions << "," << result.sourceBytes << "," << result.coldMilliseconds << "," << result.warmMilliseconds;
+		for (const std::string& stageName : stageNames)
+		{
+			outputStream << ",";
+			for (const StageTimeInfo& stage : result.stages)
+			{
+				if (stage.name == stageName)
+					outputStream << (double)stage.nanoseconds / 1000000.0;
+			}
+		}
+		outputStream << "\n";
+	}
+}
+
+static void PrintUsage()
+{
+	std::cout << "GBA_Assembler_Bench generates synthetic projects and times GBA_Assembler on them" << std::endl;
+	std::cout << "  --assembler PATH       The Release GBA_Assembler to time (Defaults To The One Built Next To This Benchmark)" << std::endl;
+	std::cout << "  --sizes N,N,...        Instructions per project (Default 1000,10000,100000,1000000,10000000)" << std::endl;
+	std::cout << "  --files N              Source files per project (Default 16)" << std::endl;
+	std::cout << "  --label-density X      Labels per instruction (Default 0.05)" << std::endl;
+	std::cout << "  --branch-ratio X       Conditional branches per instruction (Default 0.05)" << std::endl;
+	std::cout << "  --call-ratio X         CALLs per instruction (Default 0.02)" << std::endl;
+	std::cout << "  --mova-ratio X         MOVAs per instruction (Default 0.02)" << std::endl;
+	std::cout << "  --join-depth N         How many files deep the ~join chain goes (Default 0)" << std::endl;
+	std::cout << "  --sequence-bytes N     Bytes of byte sequences per project (Default 4096)" << std::endl;
+	std::cout << "  --runs N               Cold runs per size, the fastest is reported (Default 3)" << std::endl;
+	std::cout << "  --seed N               Seed for the generator (Default 1)" << std::endl;
+	std::cout << "  --work DIR             Where projects are generated (Default BenchWork)" << std::endl;
+	std::cout << "  --csv FILE             Also write the results as CSV" << std::endl;
+	std::cout << "  --keep                 Keep the generated projects" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	BenchConfigInfo config;
+
+	//The Assembler Is Built To "Bin/<Configuration>/GBA_Assembler", Next To "Bin/<Configuration>/GBA_Assembler_Bench"
+	std::filesystem::path benchPath = std::filesystem::absolute(argv[0]);
+	config.assemblerPath = benchPath.parent_path().parent_path() / "GBA_Assembler" / "GBA_Assembler";
+#ifdef _WIN32
+	config.assemblerPath += ".exe";
+#endif
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+		if (argument == "--keep")
+		{
+			config.keepSources = true;
+			continue;
+		}
+		if (argument == "--help" || i + 1 >= argc)
+		{
+			PrintUsage();
+			return 0;
+		}
+
+		const char* value = argv[++i];
+		bool valid = true;
+		if (argument == "--assembler")
+			config.assemblerPath = std::filesystem::absolute(value);
+		else if (argument == "--sizes")
+			valid = ParseSizes(value, config.sizes);
+		else if (argument == "--files")
+			valid = ParseUnsigned(value, config.files) && config.files != 0;
+		else if (argument == "--label-density")
+			valid = ParseRatio(value, config.labelDensity);
+		else if (argument == "--branch-ratio")
+			valid = ParseRatio(value, config.branchRatio);
+		else if (argument == "--call-ratio")
+			valid = ParseRatio(value, config.callRatio);
+		else if (argument == "--mova-ratio")
+			valid = ParseRatio(value, config.movAddressRatio);
+		else if (argument == "--join-depth")
+			valid = ParseUnsigned(value, config.joinDepth);
+		else if (argument == "--sequence-bytes")
+			valid = ParseUnsigned(value, config.sequenceBytes);
+		else if (argument == "--runs")
+			valid = ParseUnsigned(value, config.runs) && config.runs != 0;
+		else if (argument == "--seed")
+			valid = ParseUnsigned(value, config.seed);
+		else if (argument == "--work")
+			config.workPath = value;
+		else if (argument == "--csv")
+			config.csvPath = value;
+		else
+			valid = false;
+
+		if (!valid)
+		{
+			std::cout << "The Value Given To " << argument << " Is Not Valid!" << std::endl;
+			PrintUsage();
+			return 0;
+		}
+	}
+
+	if (config.branchRatio + config.callRatio + config.movAddressRatio > 1.0)
+	{
+		std::cout << "The Branch, CALL And MOVA Ratios Add Up To More Than 1!" << std::endl;
+		return 0;
+	}
+	if (!std::filesystem::exists(config.assemblerPath))
+	{
+		std::cout << "Could not find the assembler at " << config.assemblerPath << ", build GBA_Assembler in Release or pass --assembler" << std::endl;
+		return 0;
+	}
+	config.workPath = std::filesystem::absolute(config.workPath);
+
+	std::vector<BenchResultInfo> results;
+	for (uint64_t size : config.sizes)
+	{
+		results.push_back(BenchSize(config, size));
+		PrintResult(results.back());
+	}
+
+	if (!config.csvPath.empty())
+		WriteCsv(config.csvPath, results);
+	return 0;
+}
@@ -35,6 +35,7 @@ project "GBA_Assembler"
 	filter "system:linux"
 		pic "On"
 		systemversion "latest"
+		links "pthread"
 
 	filter "configurations:Debug"
 		defines "ASSEMBLER_CONFIG_DEBUG"
@@ -45,3 +46,43 @@ project "GBA_Assembler"
 		defines "ASSEMBLER_CONFIG_RELEASE"
 		runtime "Release"
 		optimize "On"
+
+project "GBA_Assembler_Bench"
+	location "GBA_Assembler_Bench"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++20"
+	staticruntime "On"
+
+	targetdir ("Bin/%{cfg.buildcfg}-%{cfg.architecture}-%{cfg.system}/%{prj.name}")
+	objdir ("Bin-Int/%{cfg.buildcfg}-%{cfg.architecture}-%{cfg.system}/%{prj.name}")
+
+	dependson "GBA_Assembler"
+
+	files
+	{
+		"%{prj.name}/src/**.h",
+		"%{prj.name}/src/**.cpp"
+	}
+
+	includedirs
+	{
+		"%{prj.name}/src"
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+
+	filter "system:linux"
+		pic "On"
+		systemversion "latest"
+
+	filter "configurations:Debug"
+		defines "BENCH_CONFIG_DEBUG"
+		runtime "Debug"
+		symbols "On"
+
+	filter "configurations:Release"
+		defines "BENCH_CONFIG_RELEASE"
+		runtime "Release"
+		optimize "On"